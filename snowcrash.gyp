@@ -62,12 +62,32 @@
       'sources': [
         'src/CBlueprint.cc',
         'src/CBlueprint.h',
+        'src/CBlueprintFlat.cc',
+        'src/CBlueprintFlat.h',
         'src/CBlueprintSourcemap.cc',
         'src/CBlueprintSourcemap.h',
+        'src/CCancellationToken.cc',
+        'src/CCancellationToken.h',
+        'src/CParseStatistics.cc',
+        'src/CParseStatistics.h',
+        'src/CRouteIndex.cc',
+        'src/CRouteIndex.h',
         'src/CSourceAnnotation.cc',
         'src/CSourceAnnotation.h',
+        'src/CancellationToken.h',
         'src/HTTP.cc',
         'src/HTTP.h',
+        'src/HeaderSignature.cc',
+        'src/HeaderSignature.h',
+        'src/ParameterSignature.cc',
+        'src/ParameterSignature.h',
+        'src/ParallelFor.h',
+        'src/ParseStatistics.cc',
+        'src/ParseStatistics.h',
+        'src/PayloadSignature.cc',
+        'src/PayloadSignature.h',
+        'src/RouteIndex.cc',
+        'src/RouteIndex.h',
         'src/Section.cc',
         'src/Section.h',
         'src/Serialize.cc',
@@ -89,6 +109,7 @@
         'src/ActionParser.h',
         'src/AssetParser.h',
         'src/Blueprint.h',
+        'src/BlueprintEvents.h',
         'src/BlueprintParser.h',
         'src/BlueprintSourcemap.h',
         'src/BlueprintUtility.h',
@@ -112,8 +133,8 @@
       ],
       'conditions': [
         [ 'OS=="win"',
-          { 'sources': [ 'src/win/RegexMatch.cc' ] },
-          { 'sources': [ 'src/posix/RegexMatch.cc' ] } # OS != Windows
+          { 'sources': [ 'src/win/CancellationToken.cc', 'src/win/ParallelFor.cc', 'src/win/RegexMatch.cc' ] },
+          { 'sources': [ 'src/posix/CancellationToken.cc', 'src/posix/ParallelFor.cc', 'src/posix/RegexMatch.cc' ] } # OS != Windows
         ]
       ],
       'dependencies': [
@@ -135,18 +156,26 @@
         'test/test-ActionParser.cc',
         'test/test-AssetParser.cc',
         'test/test-Blueprint.cc',
+        'test/test-BlueprintEvents.cc',
         'test/test-BlueprintParser.cc',
+        'test/test-CancellationToken.cc',
+        'test/test-Concurrency.cc',
+        'test/test-HeaderSignature.cc',
         'test/test-HeadersParser.cc',
         'test/test-Indentation.cc',
         'test/test-ParameterParser.cc',
         'test/test-ParametersParser.cc',
+        'test/test-ParseStatistics.cc',
         'test/test-PayloadParser.cc',
         'test/test-RegexMatch.cc',
         'test/test-ResourceParser.cc',
         'test/test-ResourceGroupParser.cc',
+        'test/test-RouteIndex.cc',
         'test/test-DataStructureParser.cc',
         'test/test-DataStructuresParser.cc',
         'test/test-SectionParser.cc',
+        'test/test-Serialize.cc',
+        'test/test-StringUtility.cc',
         'test/test-SymbolIdentifier.cc',
         'test/test-SymbolTable.cc',
         'test/test-UriTemplateParser.cc',
@@ -190,12 +219,46 @@
         'test/performance',
       ],
       'sources': [
-        'test/performance/perf-snowcrash.cc'
+        'test/performance/blueprint-generator.cc',
+        'test/performance/blueprint-generator.h',
+        'test/performance/perf-routing.cc',
+        'test/performance/perf-scaling.cc',
+        'test/performance/perf-snowcrash.cc',
+        'test/performance/perf-snowcrash.h',
+        'test/performance/perf-strings.cc',
+        'test/performance/perf-threads.cc'
       ],
       'dependencies': [
         'libsnowcrash',
         'libmarkdownparser'
       ]
+    },
+    {
+      'target_name': 'perf-capi',
+      'type': 'executable',
+      'include_dirs': [
+        'src'
+      ],
+      'sources': [
+        'test/performance/perf-capi.c'
+      ],
+      'dependencies': [
+        'libsnowcrash',
+        'libmarkdownparser'
+      ]
+    },
+    {
+      'target_name': 'generate-blueprint',
+      'type': 'executable',
+      'include_dirs': [
+        'ext/cmdline',
+        'test/performance'
+      ],
+      'sources': [
+        'test/performance/blueprint-generator.cc',
+        'test/performance/blueprint-generator.h',
+        'test/performance/generate-blueprint.cc'
+      ]
     }
   ]
 }
@@ -13,16 +13,11 @@
 #include "SectionParser.h"
 #include "ParametersParser.h"
 #include "PayloadParser.h"
+#include "HeaderSignature.h"
 #include "RegexMatch.h"
 
 namespace snowcrash {
 
-    /** Nameless action matching regex */
-    const char* const ActionHeaderRegex = "^[[:blank:]]*" HTTP_REQUEST_METHOD "[[:blank:]]*" URI_TEMPLATE "?$";
-
-    /** Named action matching regex */
-    const char* const NamedActionHeaderRegex = "^[[:blank:]]*" SYMBOL_IDENTIFIER "\\[" HTTP_REQUEST_METHOD "]$";
-
     /** Internal type alias for Collection iterator of Action */
     typedef Collection<Action>::const_iterator ActionIterator;
 
@@ -37,8 +32,8 @@ namespace snowcrash {
     /**
      * Action Section processor
      */
-    template<>
-    struct SectionProcessor<Action> : public SectionProcessorBase<Action> {
+    template<typename SourceMapPolicy>
+    struct SectionProcessor<Action, SourceMapPolicy> : public SectionProcessorBase<Action, SourceMapPolicy> {
 
         static MarkdownNodeIterator processSignature(const MarkdownNodeIterator& node,
                                                      const MarkdownNodes& siblings,
@@ -47,12 +42,12 @@ namespace snowcrash {
                                                      const ParseResultRef<Action>& out) {
 
             actionHTTPMethodAndName(node, out.node.method, out.node.name);
-            TrimString(out.node.name);
+            out.node.methodType = GetHTTPMethodType(out.node.method);
 
             mdp::ByteBuffer remainingContent;
             GetFirstLine(node->text, remainingContent);
 
-            if (pd.exportSourceMap()) {
+            if (SourceMapPolicy::exportSourceMap(pd)) {
                 if (!out.node.method.empty()) {
                     out.sourceMap.method.sourceMap = node->sourceMap;
                 }
@@ -63,9 +58,11 @@ namespace snowcrash {
             }
 
             if (!remainingContent.empty()) {
-                out.node.description += remainingContent;
 
-                if (pd.exportSourceMap()) {
+                if (!pd.skip(SkipDescriptionsOption))
+                    out.node.description += remainingContent;
+
+                if (SourceMapPolicy::exportSourceMap(pd) || pd.skip(SkipDescriptionsOption)) {
                     out.sourceMap.description.sourceMap.append(node->sourceMap);
                 }
             }
@@ -88,13 +85,13 @@ namespace snowcrash {
                 case ParametersSectionType:
                 {
                     ParseResultRef<Parameters> parameters(out.report, out.node.parameters, out.sourceMap.parameters);
-                    return ParametersParser::parse(node, siblings, pd, parameters);
+                    return SectionParser<Parameters, ListSectionAdapter, SourceMapPolicy>::parse(node, siblings, pd, parameters);
                 }
 
                 case AttributesSectionType:
                 {
                     ParseResultRef<Parameters> parameters(out.report, out.node.attributes, out.sourceMap.attributes);
-                    return ParametersParser::parse(node, siblings, pd, parameters);
+                    return SectionParser<Parameters, ListSectionAdapter, SourceMapPolicy>::parse(node, siblings, pd, parameters);
                 }
 
                 case RequestSectionType:
@@ -102,24 +99,26 @@ namespace snowcrash {
                 {
                     IntermediateParseResult<Payload> payload(out.report);
 
-                    cur = PayloadParser::parse(node, siblings, pd, payload);
+                    cur = SectionParser<Payload, ListSectionAdapter, SourceMapPolicy>::parse(node, siblings, pd, payload);
 
                     if (out.node.examples.empty() || !out.node.examples.back().responses.empty()) {
-                        TransactionExample transaction;
-                        SourceMap<TransactionExample> transactionSM;
-
-                        out.node.examples.push_back(transaction);
+                        out.node.examples.push_back(TransactionExample());
 
-                        if (pd.exportSourceMap()) {
-                            out.sourceMap.examples.collection.push_back(transactionSM);
+                        if (trackExamples(pd)) {
+                            out.sourceMap.examples.collection.push_back(SourceMap<TransactionExample>());
                         }
                     }
 
-                    checkPayload(sectionType, sourceMap, payload.node, out);
+                    checkPayload(sectionType, sourceMap, payload.node, payload.sourceMap, pd, out);
+
+                    if (pd.skip(SkipParametersOption)) {
+                        payload.node.parameters.clear();
+                        payload.sourceMap.parameters.collection.clear();
+                    }
 
                     out.node.examples.back().requests.push_back(payload.node);
 
-                    if (pd.exportSourceMap()) {
+                    if (trackExamples(pd)) {
                         out.sourceMap.examples.collection.back().requests.collection.push_back(payload.sourceMap);
                     }
 
@@ -131,24 +130,26 @@ namespace snowcrash {
                 {
                     IntermediateParseResult<Payload> payload(out.report);
 
-                    cur = PayloadParser::parse(node, siblings, pd, payload);
+                    cur = SectionParser<Payload, ListSectionAdapter, SourceMapPolicy>::parse(node, siblings, pd, payload);
 
                     if (out.node.examples.empty()) {
-                        TransactionExample transaction;
-                        SourceMap<TransactionExample> transactionSM;
+                        out.node.examples.push_back(TransactionExample());
 
-                        out.node.examples.push_back(transaction);
-
-                        if (pd.exportSourceMap()) {
-                            out.sourceMap.examples.collection.push_back(transactionSM);
+                        if (trackExamples(pd)) {
+                            out.sourceMap.examples.collection.push_back(SourceMap<TransactionExample>());
                         }
                     }
 
-                    checkPayload(sectionType, sourceMap, payload.node, out);
+                    checkPayload(sectionType, sourceMap, payload.node, payload.sourceMap, pd, out);
+
+                    if (pd.skip(SkipParametersOption)) {
+                        payload.node.parameters.clear();
+                        payload.sourceMap.parameters.collection.clear();
+                    }
 
                     out.node.examples.back().responses.push_back(payload.node);
 
-                    if (pd.exportSourceMap()) {
+                    if (trackExamples(pd)) {
                         out.sourceMap.examples.collection.back().responses.collection.push_back(payload.sourceMap);
                     }
 
@@ -158,7 +159,7 @@ namespace snowcrash {
                 case HeadersSectionType:
                 {
                     ParseResultRef<Headers> headers(out.report, out.node.headers, out.sourceMap.headers);
-                    return SectionProcessor<Action>::handleDeprecatedHeaders(node, siblings, pd, headers);
+                    return SectionProcessor<Action, SourceMapPolicy>::handleDeprecatedHeaders(node, siblings, pd, headers);
                 }
 
                 default:
@@ -168,14 +169,19 @@ namespace snowcrash {
             return cur;
         }
 
+        /** \returns True if the example source maps are kept, they tell where skipped bodies are */
+        static bool trackExamples(const SectionParserData& pd) {
+            return SourceMapPolicy::exportSourceMap(pd) || pd.skip(SkipBodiesOption);
+        }
+
         static bool isUnexpectedNode(const MarkdownNodeIterator& node,
                                      SectionType sectionType) {
 
-            if (SectionProcessor<Asset>::sectionType(node) != UndefinedSectionType) {
+            if (SectionProcessor<Asset, SourceMapPolicy>::sectionType(node) != UndefinedSectionType) {
                 return true;
             }
 
-            return SectionProcessorBase<Action>::isUnexpectedNode(node, sectionType);
+            return SectionProcessorBase<Action, SourceMapPolicy>::isUnexpectedNode(node, sectionType);
         }
 
         static MarkdownNodeIterator processUnexpectedNode(const MarkdownNodeIterator& node,
@@ -191,9 +197,10 @@ namespace snowcrash {
                 !out.node.examples.empty() &&
                 !out.node.examples.back().responses.empty()) {
 
-                mdp::ByteBuffer content = CodeBlockUtility::addDanglingAsset(node, pd, sectionType, out.report, out.node.examples.back().responses.back().body);
+                bool skip = pd.skip(SkipBodiesOption);
+                bool added = CodeBlockUtility::addDanglingAsset(node, pd, sectionType, out.report, skip ? NULL : &out.node.examples.back().responses.back().body);
 
-                if (pd.exportSourceMap() && !content.empty()) {
+                if (trackExamples(pd) && added) {
                     out.sourceMap.examples.collection.back().responses.collection.back().body.sourceMap.append(node->sourceMap);
                 }
 
@@ -207,16 +214,17 @@ namespace snowcrash {
                 !out.node.examples.empty() &&
                 !out.node.examples.back().requests.empty()) {
 
-                mdp::ByteBuffer content = CodeBlockUtility::addDanglingAsset(node, pd, sectionType, out.report, out.node.examples.back().requests.back().body);
+                bool skip = pd.skip(SkipBodiesOption);
+                bool added = CodeBlockUtility::addDanglingAsset(node, pd, sectionType, out.report, skip ? NULL : &out.node.examples.back().requests.back().body);
 
-                if (pd.exportSourceMap() && !content.empty()) {
+                if (trackExamples(pd) && added) {
                     out.sourceMap.examples.collection.back().requests.collection.back().body.sourceMap.append(node->sourceMap);
                 }
 
                 return ++MarkdownNodeIterator(node);
             }
 
-            SectionType assetType = SectionProcessor<Asset>::sectionType(node);
+            SectionType assetType = SectionProcessor<Asset, SourceMapPolicy>::sectionType(node);
 
             if (assetType != UndefinedSectionType) {
 
@@ -234,7 +242,7 @@ namespace snowcrash {
                 return ++MarkdownNodeIterator(node);
             }
 
-            return SectionProcessorBase<Action>::processUnexpectedNode(node, siblings, pd, sectionType, out);
+            return SectionProcessorBase<Action, SourceMapPolicy>::processUnexpectedNode(node, siblings, pd, sectionType, out);
         }
 
         static SectionType sectionType(const MarkdownNodeIterator& node) {
@@ -242,11 +250,12 @@ namespace snowcrash {
             if (node->type == mdp::HeaderMarkdownNodeType
                 && !node->text.empty()) {
 
+                HeaderSignature signature;
                 mdp::ByteBuffer subject = node->text;
                 TrimString(subject);
 
-                if (RegexMatch(subject, ActionHeaderRegex) ||
-                    RegexMatch(subject, NamedActionHeaderRegex)) {
+                if (ScanActionHeader(subject, signature) ||
+                    ScanNamedActionHeader(subject, signature)) {
 
                     return ActionSectionType;
                 }
@@ -260,21 +269,21 @@ namespace snowcrash {
             SectionType nestedType = UndefinedSectionType;
 
             // Check if parameters section
-            nestedType = SectionProcessor<Parameters>::sectionType(node);
+            nestedType = SectionProcessor<Parameters, SourceMapPolicy>::sectionType(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if headers section
-            nestedType = SectionProcessor<Headers>::sectionType(node);
+            nestedType = SectionProcessor<Headers, SourceMapPolicy>::sectionType(node);
 
             if (nestedType == HeadersSectionType) {
                 return nestedType;
             }
 
             // Check if payload section
-            nestedType = SectionProcessor<Payload>::sectionType(node);
+            nestedType = SectionProcessor<Payload, SourceMapPolicy>::sectionType(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
@@ -292,7 +301,7 @@ namespace snowcrash {
             nested.push_back(RequestBodySectionType);
             nested.push_back(RequestSectionType);
 
-            types = SectionProcessor<Payload>::nestedSectionTypes();
+            types = SectionProcessor<Payload, SourceMapPolicy>::nestedSectionTypes();
             nested.insert(nested.end(), types.begin(), types.end());
 
             return nested;
@@ -304,10 +313,10 @@ namespace snowcrash {
 
             if (!out.node.headers.empty()) {
 
-                SectionProcessor<Headers>::injectDeprecatedHeaders(pd, out.node.headers, out.sourceMap.headers, out.node.examples, out.sourceMap.examples);
+                SectionProcessor<Headers, SourceMapPolicy>::injectDeprecatedHeaders(pd, out.node.headers, out.sourceMap.headers, out.node.examples, out.sourceMap.examples);
                 out.node.headers.clear();
 
-                if (pd.exportSourceMap()) {
+                if (SourceMapPolicy::exportSourceMap(pd)) {
                     out.sourceMap.headers.collection.clear();
                 }
             }
@@ -338,6 +347,9 @@ namespace snowcrash {
                                                       EmptyDefinitionWarning,
                                                       sourceMap));
             }
+
+            if (pd.events)
+                pd.events->action(out.node);
         }
 
         /**
@@ -345,12 +357,16 @@ namespace snowcrash {
          *  \param  sectionType A section of the payload.
          *  \param  sourceMap   Payload signature source map.
          *  \param  payload     The payload to be checked.
+         *  \param  payloadSourceMap  Source map of the payload.
+         *  \param  pd          Section parser state.
          *  \param  action      The Action to which payload belongs to.
          *  \param  report      Parser report.
          */
         static void checkPayload(SectionType sectionType,
                                  const mdp::CharactersRangeSet sourceMap,
                                  const Payload& payload,
+                                 const SourceMap<Payload>& payloadSourceMap,
+                                 const SectionParserData& pd,
                                  const ParseResultRef<Action>& out) {
 
             if (isPayloadDuplicate(sectionType, payload, out.node.examples.back())) {
@@ -367,18 +383,14 @@ namespace snowcrash {
 
             if (sectionType == ResponseSectionType || sectionType == ResponseBodySectionType) {
 
-                HTTPStatusCode code;
-
-                if (!payload.name.empty()) {
-                    std::stringstream(payload.name) >> code;
-                }
-
-                HTTPMethodTraits methodTraits = GetMethodTrait(out.node.method);
+                HTTPStatusCode code = payload.statusCode;
+                HTTPMethodTraits methodTraits = GetMethodTrait(out.node.methodType);
 
-                if (!methodTraits.allowBody && !payload.body.empty()) {
+                if (!methodTraits.allowBody &&
+                    SectionProcessor<Payload, SourceMapPolicy>::hasBody(pd, payload, payloadSourceMap)) {
 
                     // WARN: Edge case for 2xx CONNECT
-                    if (out.node.method == HTTPMethodName::Connect && code/100 == 2) {
+                    if (out.node.methodType == CONNECTHTTPMethodType && code/100 == 2) {
 
                         std::stringstream ss;
                         ss << "the response for " << code << " " << out.node.method << " request MUST NOT include a " << SectionName(BodySectionType);
@@ -386,7 +398,7 @@ namespace snowcrash {
                         out.report.warnings.push_back(Warning(ss.str(),
                                                               EmptyDefinitionWarning,
                                                               sourceMap));
-                    } else if (out.node.method != HTTPMethodName::Connect && !methodTraits.allowBody) {
+                    } else if (out.node.methodType != CONNECTHTTPMethodType && !methodTraits.allowBody) {
 
                         std::stringstream ss;
                         ss << "the response for " << out.node.method << " request MUST NOT include a " << SectionName(BodySectionType);
@@ -411,11 +423,11 @@ namespace snowcrash {
 
             if (sectionType == RequestSectionType) {
 
-                RequestIterator duplicate = SectionProcessor<Payload>::findRequest(example, payload);
+                RequestIterator duplicate = SectionProcessor<Payload, SourceMapPolicy>::findRequest(example, payload);
                 return duplicate != example.requests.end();
             } else if (sectionType == ResponseSectionType) {
 
-                ResponseIterator duplicate = SectionProcessor<Payload>::findResponse(example, payload);
+                ResponseIterator duplicate = SectionProcessor<Payload, SourceMapPolicy>::findResponse(example, payload);
                 return duplicate != example.responses.end();
             }
 
@@ -428,7 +440,7 @@ namespace snowcrash {
                                                             SectionParserData& pd,
                                                             const ParseResultRef<Headers>& out) {
 
-            MarkdownNodeIterator cur = HeadersParser::parse(node, siblings, pd, out);
+            MarkdownNodeIterator cur = SectionParser<Headers, ListSectionAdapter, SourceMapPolicy>::parse(node, siblings, pd, out);
 
             // WARN: Deprecated header sections
             std::stringstream ss;
@@ -448,17 +460,17 @@ namespace snowcrash {
             if (node->type != mdp::HeaderMarkdownNodeType || node->text.empty())
                 return NotActionType;
 
+            HeaderSignature signature;
             mdp::ByteBuffer subject = node->text;
             TrimString(subject);
 
-            if (RegexMatch(subject, NamedActionHeaderRegex)) {
+            if (ScanNamedActionHeader(subject, signature)) {
                 return DependentActionType;
             }
 
-            CaptureGroups captureGroups;
-            if (RegexCapture(subject, ActionHeaderRegex, captureGroups, 3)) {
+            if (ScanActionHeader(subject, signature)) {
 
-                if (captureGroups[2].empty()) {
+                if (signature.uriTemplate.length == 0) {
                     return DependentActionType;
                 }
                 else {
@@ -474,17 +486,17 @@ namespace snowcrash {
                                             mdp::ByteBuffer& method,
                                             mdp::ByteBuffer& name) {
 
-            CaptureGroups captureGroups;
+            HeaderSignature signature;
             mdp::ByteBuffer subject, remaining;
 
             subject = GetFirstLine(node->text, remaining);
             TrimString(subject);
 
-            if (RegexCapture(subject, ActionHeaderRegex, captureGroups, 3)) {
-                method = captureGroups[1];
-            } else if (RegexCapture(subject, NamedActionHeaderRegex, captureGroups, 3)) {
-                name = captureGroups[1];
-                method = captureGroups[2];
+            if (ScanActionHeader(subject, signature)) {
+                method = HeaderSignature::part(subject, signature.method);
+            } else if (ScanNamedActionHeader(subject, signature)) {
+                name = HeaderSignature::part(subject, signature.name);
+                method = HeaderSignature::part(subject, signature.method);
             }
 
             return;
@@ -24,17 +24,11 @@ namespace snowcrash {
         UndefinedAssetSignature = -1
     };
 
-    /** Body matching regex */
-    const char* const BodyRegex = "^[[:blank:]]*[Bb]ody[[:blank:]]*$";
-
-    /** Schema matching regex */
-    const char* const SchemaRegex = "^[[:blank:]]*[Ss]chema[[:blank:]]*$";
-
     /**
      *  Asset Section Processor
      */
-    template<>
-    struct SectionProcessor<Asset> : public SectionProcessorBase<Asset> {
+    template<typename SourceMapPolicy>
+    struct SectionProcessor<Asset, SourceMapPolicy> : public SectionProcessorBase<Asset, SourceMapPolicy> {
 
         static MarkdownNodeIterator processSignature(const MarkdownNodeIterator& node,
                                                      const MarkdownNodes& siblings,
@@ -42,10 +36,12 @@ namespace snowcrash {
                                                      SectionLayout& layout,
                                                      const ParseResultRef<Asset>& out) {
 
+            bool skip = isSkipped(pd);
+
             out.node = "";
-            CodeBlockUtility::signatureContentAsCodeBlock(node, pd, out.report, out.node);
+            bool added = CodeBlockUtility::signatureContentAsCodeBlock(node, pd, out.report, skip ? NULL : &out.node);
 
-            if (pd.exportSourceMap() && !out.node.empty()) {
+            if ((SourceMapPolicy::exportSourceMap(pd) || skip) && added) {
                 out.sourceMap.sourceMap.append(node->sourceMap);
             }
 
@@ -65,12 +61,10 @@ namespace snowcrash {
                                                    SectionParserData& pd,
                                                    const ParseResultRef<Asset>& out) {
 
-            mdp::ByteBuffer content;
-            CodeBlockUtility::contentAsCodeBlock(node, pd, out.report, content);
-
-            out.node += content;
+            bool skip = isSkipped(pd);
+            bool added = CodeBlockUtility::contentAsCodeBlock(node, pd, out.report, skip ? NULL : &out.node);
 
-            if (pd.exportSourceMap() && !content.empty()) {
+            if ((SourceMapPolicy::exportSourceMap(pd) || skip) && added) {
                 out.sourceMap.sourceMap.append(node->sourceMap);
             }
 
@@ -110,17 +104,25 @@ namespace snowcrash {
             return UndefinedSectionType;
         }
 
+        /** \returns True if the asset being parsed is dropped by the parser options */
+        static bool isSkipped(const SectionParserData& pd) {
+
+            if (pd.sectionContext() == SchemaSectionType)
+                return pd.skip(SkipSchemasOption);
+
+            return pd.skip(SkipBodiesOption);
+        }
+
         /** Resolve asset signature */
         static AssetSignature assetSignature(const MarkdownNodeIterator& node) {
 
-            mdp::ByteBuffer remaining, subject = node->children().front().text;
-            subject = GetFirstLine(subject, remaining);
-            TrimString(subject);
+            StringView remaining;
+            StringView subject = TrimView(FirstLineView(StringView(node->children().front().text), remaining));
 
-            if (RegexMatch(subject, BodyRegex))
+            if (MatchSectionKeyword(subject, "Body"))
                 return BodyAssetSignature;
 
-            if (RegexMatch(subject, SchemaRegex))
+            if (MatchSectionKeyword(subject, "Schema"))
                 return SchemaAssetSignature;
 
             return NoAssetSignature;
@@ -44,6 +44,34 @@ namespace snowcrash {
     /** HTTP Method */
     typedef std::string HTTPMethod;
 
+    /**
+     *  \brief HTTP Method Type
+     *
+     *  One type for every method of HTTP_REQUEST_METHOD, in the same order.
+     */
+    enum HTTPMethodType {
+        UndefinedHTTPMethodType = 0,
+        GETHTTPMethodType,
+        POSTHTTPMethodType,
+        PUTHTTPMethodType,
+        DELETEHTTPMethodType,
+        OPTIONSHTTPMethodType,
+        PATCHHTTPMethodType,
+        PROPPATCHHTTPMethodType,
+        LOCKHTTPMethodType,
+        UNLOCKHTTPMethodType,
+        COPYHTTPMethodType,
+        MOVEHTTPMethodType,
+        MKCOLHTTPMethodType,
+        HEADHTTPMethodType,
+        LINKHTTPMethodType,
+        UNLINKHTTPMethodType,
+        CONNECTHTTPMethodType
+    };
+
+    /** A HTTP Status code, 0 when not defined */
+    typedef unsigned int HTTPStatusCode;
+
     /** Parameter Type */
     typedef std::string Type;
 
@@ -170,9 +198,14 @@ namespace snowcrash {
      */
     struct Payload {
 
+        Payload() : statusCode(0) {}
+
         /** A Payload Name */
         Name name;
 
+        /** HTTP status code of a response, parsed from its name */
+        HTTPStatusCode statusCode;
+
         /** Payload Description */
         Description description;
 
@@ -250,9 +283,14 @@ namespace snowcrash {
      */
     struct Action {
 
+        Action() : methodType(UndefinedHTTPMethodType) {}
+
         /** HTTP method */
         HTTPMethod method;
 
+        /** HTTP method type, parsed from the method */
+        HTTPMethodType methodType;
+
         /** An Action name */
         Name name;
 
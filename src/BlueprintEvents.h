@@ -0,0 +1,92 @@
+//
+//  BlueprintEvents.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_BLUEPRINTEVENTS_H
+#define SNOWCRASH_BLUEPRINTEVENTS_H
+
+#include "Blueprint.h"
+#include "Section.h"
+#include "SourceAnnotation.h"
+
+namespace snowcrash {
+
+    /**
+     *  \brief Receiver of blueprint parsing events.
+     *
+     *  Events are emitted in source order as the parser completes the entities.
+     *  Every event has an empty default implementation, override the events of
+     *  interest. Entities passed to the events are valid only for the duration
+     *  of the call.
+     *
+     *  Actions are reported between the start and end of their resource,
+     *  resources between the start and end of their group. A payload referring
+     *  to a model defined later in the blueprint is reported with the reference
+     *  still pending, such references are resolved only after the whole
+     *  blueprint has been parsed.
+     *
+     *  Entities are not kept once reported. A resource is held only until its
+     *  end event, a summary of it stays for the checks of later sections, see
+     *  `resourceGroupEnd()`. Data structures are not reported and not kept.
+     *
+     *  Warnings are delivered as the parser goes, each one before the next
+     *  entity event following it. Warnings of the checks run after the whole
+     *  blueprint has been parsed come after the last entity event, followed by
+     *  the error if parsing has failed.
+     */
+    class BlueprintEvents {
+    public:
+        virtual ~BlueprintEvents() {}
+
+        /** Resource group signature has been parsed, its resources follow */
+        virtual void resourceGroupStart(const ResourceGroup& group) {}
+
+        /**
+         *  \brief Resource group has been completed
+         *
+         *  Its resources have been reported already, the group only holds
+         *  their URI templates and names.
+         */
+        virtual void resourceGroupEnd(const ResourceGroup& group) {}
+
+        /** Resource signature has been parsed, its actions follow */
+        virtual void resourceStart(const Resource& resource) {}
+
+        /** Resource has been completed */
+        virtual void resourceEnd(const Resource& resource) {}
+
+        /**
+         *  \brief Action has been completed
+         *
+         *  Parameters skipped by the parser options are dropped only after
+         *  they are checked, the action may still carry its own parameters.
+         */
+        virtual void action(const Action& action) {}
+
+        /**
+         *  \brief Payload has been completed
+         *
+         *  Skipped bodies, schemas and descriptions are never included.
+         *  Skipped parameters are dropped after their checks, the payload
+         *  may still carry them.
+         *
+         *  \param type  Request, response or model section type of the payload
+         */
+        virtual void payload(const Payload& payload, SectionType type) {}
+
+        /** URI parameter or attribute has been completed */
+        virtual void parameter(const Parameter& parameter) {}
+
+        /** Parser warning, reported before the next entity event */
+        virtual void warning(const Warning& warning) {}
+
+        /** Parser error, reported last, parsing has stopped */
+        virtual void error(const Error& error) {}
+    };
+}
+
+#endif
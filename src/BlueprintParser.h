@@ -27,8 +27,8 @@ namespace snowcrash {
     /**
      * Blueprint processor
      */
-    template<>
-    struct SectionProcessor<Blueprint> : public SectionProcessorBase<Blueprint> {
+    template<typename SourceMapPolicy>
+    struct SectionProcessor<Blueprint, SourceMapPolicy> : public SectionProcessorBase<Blueprint, SourceMapPolicy> {
 
         static MarkdownNodeIterator processSignature(const MarkdownNodeIterator& node,
                                                      const MarkdownNodes& siblings,
@@ -47,11 +47,11 @@ namespace snowcrash {
 
                 // First block is paragraph and is not metadata (no API name)
                 if (metadata.node.empty()) {
-                    return processDescription(cur, siblings, pd, out);
+                    return SectionProcessor<Blueprint, SourceMapPolicy>::processDescription(cur, siblings, pd, out);
                 } else {
                     out.node.metadata.insert(out.node.metadata.end(), metadata.node.begin(), metadata.node.end());
 
-                    if (pd.exportSourceMap()) {
+                    if (SourceMapPolicy::exportSourceMap(pd)) {
                         out.sourceMap.metadata.collection.insert(out.sourceMap.metadata.collection.end(),
                                                                  metadata.sourceMap.collection.begin(),
                                                                  metadata.sourceMap.collection.end());
@@ -80,13 +80,13 @@ namespace snowcrash {
                 out.node.name = cur->text;
                 TrimString(out.node.name);
 
-                if (pd.exportSourceMap() && !out.node.name.empty()) {
+                if (SourceMapPolicy::exportSourceMap(pd) && !out.node.name.empty()) {
                     out.sourceMap.name.sourceMap = cur->sourceMap;
                 }
             } else {
 
                 // Any other type of block, add to description
-                return processDescription(cur, siblings, pd, out);
+                return SectionProcessor<Blueprint, SourceMapPolicy>::processDescription(cur, siblings, pd, out);
             }
 
             return ++MarkdownNodeIterator(cur);
@@ -102,7 +102,7 @@ namespace snowcrash {
 
                 IntermediateParseResult<ResourceGroup> resourceGroup(out.report);
 
-                MarkdownNodeIterator cur = ResourceGroupParser::parse(node, siblings, pd, resourceGroup);
+                MarkdownNodeIterator cur = SectionParser<ResourceGroup, HeaderSectionAdapter, SourceMapPolicy>::parse(node, siblings, pd, resourceGroup);
 
                 ResourceGroupIterator duplicate = findResourceGroup(out.node.resourceGroups, resourceGroup.node);
 
@@ -125,20 +125,25 @@ namespace snowcrash {
                                                           sourceMap));
                 }
 
+                // Reported as events, the name is kept for the duplicate check
+                if (pd.events)
+                    resourceGroup.node.description.clear();
+
                 out.node.resourceGroups.push_back(resourceGroup.node);
 
-                if (pd.exportSourceMap()) {
+                if (SourceMapPolicy::exportSourceMap(pd)) {
                     out.sourceMap.resourceGroups.collection.push_back(resourceGroup.sourceMap);
                 }
 
                 return cur;
             } else if (pd.sectionContext() == DataStructuresSectionType) {
                 IntermediateParseResult<DataStructures> ds(out.report);
-                MarkdownNodeIterator cur = DataStructuresParser::parse(node, siblings, pd, ds);
+                MarkdownNodeIterator cur = SectionParser<DataStructures, HeaderSectionAdapter, SourceMapPolicy>::parse(node, siblings, pd, ds);
 
-                out.node.dataStructures = ds.node;
+                if (!pd.events)
+                    out.node.dataStructures = ds.node;
 
-                if (pd.exportSourceMap()) {
+                if (SourceMapPolicy::exportSourceMap(pd)) {
                     out.sourceMap.dataStructures = ds.sourceMap;
                 }
 
@@ -158,21 +163,21 @@ namespace snowcrash {
             SectionType nestedType = UndefinedSectionType;
 
             // Check if Resource section
-            nestedType = SectionProcessor<Resource>::sectionType(node);
+            nestedType = SectionProcessor<Resource, SourceMapPolicy>::sectionType(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if ResourceGroup section
-            nestedType = SectionProcessor<ResourceGroup>::sectionType(node);
+            nestedType = SectionProcessor<ResourceGroup, SourceMapPolicy>::sectionType(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if DataStructures section
-            nestedType = SectionProcessor<DataStructures>::sectionType(node);
+            nestedType = SectionProcessor<DataStructures, SourceMapPolicy>::sectionType(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
@@ -197,7 +202,7 @@ namespace snowcrash {
 
         template<typename T>
         static void insertNestedSectionTypes(SectionTypes& nested) {
-            SectionTypes types = SectionProcessor<T>::nestedSectionTypes();
+            SectionTypes types = SectionProcessor<T, SourceMapPolicy>::nestedSectionTypes();
             nested.insert(nested.end(), types.begin(), types.end());
         }
 
@@ -206,6 +211,17 @@ namespace snowcrash {
                              const ParseResultRef<Blueprint>& out) {
      
             checkLazyReferencing(pd, out);
+            checkName(node, pd, out);
+
+            // The description ranges of skipped descriptions were kept for the name check only
+            if (!SourceMapPolicy::exportSourceMap(pd))
+                out.sourceMap.description.sourceMap.clear();
+        }
+
+        /** Check & report missing API name */
+        static void checkName(const MarkdownNodeIterator& node,
+                              SectionParserData& pd,
+                              const ParseResultRef<Blueprint>& out) {
 
             if (!out.node.name.empty())
                 return;
@@ -219,7 +235,8 @@ namespace snowcrash {
                                          sourceMap);
 
             }
-            else if (!out.node.description.empty()) {
+            else if (!out.node.description.empty() ||
+                     (pd.skip(SkipDescriptionsOption) && !out.sourceMap.description.sourceMap.empty())) {
                 mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
                 out.report.warnings.push_back(Warning(ExpectedAPINameMessage,
                                                       APINameWarning,
@@ -239,21 +256,19 @@ namespace snowcrash {
                                   SectionParserData& pd,
                                   const ParseResultRef<MetadataCollection>& out) {
 
-            mdp::ByteBuffer content = node->text;
-            TrimStringEnd(content);
+            LineIterator lines(TrimViewEnd(StringView(node->text)));
+            StringView line;
+            size_t lineCount = 0;
 
-            std::vector<mdp::ByteBuffer> lines = Split(content, '\n');
-
-            for (std::vector<mdp::ByteBuffer>::iterator it = lines.begin();
-                 it != lines.end();
-                 ++it) {
+            while (lines.next(line)) {
 
                 Metadata metadata;
+                ++lineCount;
 
-                if (CodeBlockUtility::keyValueFromLine(*it, metadata)) {
+                if (CodeBlockUtility::keyValueFromLine(line, metadata)) {
                     out.node.push_back(metadata);
 
-                    if (pd.exportSourceMap()) {
+                    if (SourceMapPolicy::exportSourceMap(pd)) {
                         SourceMap<Metadata> metadataSM;
                         metadataSM.sourceMap = node->sourceMap;
                         out.sourceMap.collection.push_back(metadataSM);
@@ -261,7 +276,7 @@ namespace snowcrash {
                 }
             }
 
-            if (lines.size() == out.node.size()) {
+            if (lineCount == out.node.size()) {
 
                 // Check duplicates
                 std::vector<mdp::ByteBuffer> duplicateKeys;
@@ -323,7 +338,7 @@ namespace snowcrash {
 
             Collection<SourceMap<ResourceGroup> >::iterator resourceGroupSourceMapIt;
 
-            if (pd.exportSourceMap()) {
+            if (SourceMapPolicy::exportSourceMap(pd)) {
                 resourceGroupSourceMapIt = out.sourceMap.resourceGroups.collection.begin();
             }
 
@@ -333,7 +348,7 @@ namespace snowcrash {
 
                 checkResourceLazyReferencing(*resourceGroupIt, resourceGroupSourceMapIt, pd, out);
 
-                if (pd.exportSourceMap()) {
+                if (SourceMapPolicy::exportSourceMap(pd)) {
                     resourceGroupSourceMapIt++;
                 }
             }
@@ -347,7 +362,7 @@ namespace snowcrash {
 
             Collection<SourceMap<Resource> >::iterator resourceSourceMapIt;
 
-            if (pd.exportSourceMap()) {
+            if (SourceMapPolicy::exportSourceMap(pd)) {
                 resourceSourceMapIt = resourceGroupSourceMapIt->resources.collection.begin();
             }
 
@@ -357,7 +372,7 @@ namespace snowcrash {
 
                 checkActionLazyReferencing(*resourceIt, resourceSourceMapIt, pd, out);
 
-                if (pd.exportSourceMap()) {
+                if (SourceMapPolicy::exportSourceMap(pd)) {
                     resourceSourceMapIt++;
                 }
             }
@@ -371,7 +386,7 @@ namespace snowcrash {
 
             Collection<SourceMap<Action> >::iterator actionSourceMapIt;
 
-            if (pd.exportSourceMap()) {
+            if (SourceMapPolicy::exportSourceMap(pd)) {
                 actionSourceMapIt = resourceSourceMapIt->actions.collection.begin();
             }
 
@@ -381,7 +396,7 @@ namespace snowcrash {
 
                 checkExampleLazyReferencing(*actionIt, actionSourceMapIt, pd, out);
 
-                if (pd.exportSourceMap()) {
+                if (SourceMapPolicy::exportSourceMap(pd)) {
                     actionSourceMapIt++;
                 }
             }
@@ -395,7 +410,7 @@ namespace snowcrash {
 
             Collection<SourceMap<TransactionExample> >::iterator exampleSourceMapIt;
 
-            if (pd.exportSourceMap()) {
+            if (SourceMapPolicy::exportSourceMap(pd)) {
                 exampleSourceMapIt = actionSourceMapIt->examples.collection.begin();
             }
 
@@ -406,7 +421,7 @@ namespace snowcrash {
                 checkRequestLazyReferencing(*transactionExampleIt, exampleSourceMapIt, pd, out);
                 checkResponseLazyReferencing(*transactionExampleIt, exampleSourceMapIt, pd, out);
 
-                if (pd.exportSourceMap()) {
+                if (SourceMapPolicy::exportSourceMap(pd)) {
                     exampleSourceMapIt++;
                 }
             }
@@ -420,7 +435,7 @@ namespace snowcrash {
 
             Collection<SourceMap<Request> >::iterator requestSourceMapIt;
 
-            if (pd.exportSourceMap()) {
+            if (SourceMapPolicy::exportSourceMap(pd)) {
                 requestSourceMapIt = transactionExampleSourceMapIt->requests.collection.begin();
             }
 
@@ -431,22 +446,15 @@ namespace snowcrash {
                 if (!requestIt->reference.id.empty() &&
                     requestIt->reference.meta.state == Reference::StatePending) {
 
-                    if (pd.exportSourceMap()) {
-
-                        ParseResultRef<Payload> payload(out.report, *requestIt, *requestSourceMapIt);
-                        resolvePendingSymbols(pd, payload);
-                        SectionProcessor<Payload>::checkRequest(requestIt->reference.meta.node, pd, payload);
-                    }
-                    else {
+                    SourceMap<Payload> tempSourceMap;
+                    SourceMap<Payload>& sourceMap = SourceMapPolicy::exportSourceMap(pd) ? *requestSourceMapIt : tempSourceMap;
 
-                        SourceMap<Payload> tempSourceMap;
-                        ParseResultRef<Payload> payload(out.report, *requestIt, tempSourceMap);
-                        resolvePendingSymbols(pd, payload);
-                        SectionProcessor<Payload>::checkRequest(requestIt->reference.meta.node, pd, payload);
-                    }
+                    ParseResultRef<Payload> payload(out.report, *requestIt, sourceMap);
+                    resolvePendingSymbols(pd, payload);
+                    SectionProcessor<Payload, SourceMapPolicy>::checkRequest(requestIt->reference.meta.node, pd, payload);
                 }
 
-                if (pd.exportSourceMap()) {
+                if (SourceMapPolicy::exportSourceMap(pd)) {
                     requestSourceMapIt++;
                 }
             }
@@ -460,7 +468,7 @@ namespace snowcrash {
 
             Collection<SourceMap<Response> >::iterator responseSourceMapIt;
 
-            if (pd.exportSourceMap()) {
+            if (SourceMapPolicy::exportSourceMap(pd)) {
                 responseSourceMapIt = transactionExampleSourceMapIt->responses.collection.begin();
             }
 
@@ -471,22 +479,15 @@ namespace snowcrash {
                 if (!responseIt->reference.id.empty() &&
                     responseIt->reference.meta.state == Reference::StatePending) {
 
-                    if (pd.exportSourceMap()) {
-
-                        ParseResultRef<Payload> payload(out.report, *responseIt, *responseSourceMapIt);
-                        resolvePendingSymbols(pd, payload);
-                        SectionProcessor<Payload>::checkResponse(responseIt->reference.meta.node, pd, payload);
-                    }
-                    else {
+                    SourceMap<Payload> tempSourceMap;
+                    SourceMap<Payload>& sourceMap = SourceMapPolicy::exportSourceMap(pd) ? *responseSourceMapIt : tempSourceMap;
 
-                        SourceMap<Payload> tempSourceMap;
-                        ParseResultRef<Payload> payload(out.report, *responseIt, tempSourceMap);
-                        resolvePendingSymbols(pd, payload);
-                        SectionProcessor<Payload>::checkResponse(responseIt->reference.meta.node, pd, payload);
-                    }
+                    ParseResultRef<Payload> payload(out.report, *responseIt, sourceMap);
+                    resolvePendingSymbols(pd, payload);
+                    SectionProcessor<Payload, SourceMapPolicy>::checkResponse(responseIt->reference.meta.node, pd, payload);
                 }
 
-                if (pd.exportSourceMap()) {
+                if (SourceMapPolicy::exportSourceMap(pd)) {
                     responseSourceMapIt++;
                 }
             }
@@ -514,13 +515,19 @@ namespace snowcrash {
             else {
 
                 out.node.reference.meta.state = Reference::StateResolved;
-                SectionProcessor<Payload>::assingReferredPayload(pd, out);
+                SectionProcessor<Payload, SourceMapPolicy>::assingReferredPayload(pd, out);
             }
         }
     };
 
     /** Blueprint Parser */
     typedef SectionParser<Blueprint, BlueprintSectionAdapter> BlueprintParser;
+
+    /** Blueprint parser exporting source maps regardless of the parser options */
+    typedef SectionParser<Blueprint, BlueprintSectionAdapter, ExportSourceMapPolicy> SourceMapBlueprintParser;
+
+    /** Blueprint parser with all of the source map work compiled out */
+    typedef SectionParser<Blueprint, BlueprintSectionAdapter, NoSourceMapPolicy> NoSourceMapBlueprintParser;
 }
 
 #endif
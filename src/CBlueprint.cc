@@ -358,6 +358,15 @@ SC_API const char* sc_payload_name(const sc_payload_t* handle)
     return p->name.c_str();
 }
 
+SC_API unsigned int sc_payload_status_code(const sc_payload_t* handle)
+{
+    const snowcrash::Payload* p = AS_CTYPE(snowcrash::Payload, handle);
+    if (!p)
+        return 0;
+
+    return p->statusCode;
+}
+
 SC_API const char* sc_payload_description(const sc_payload_t* handle)
 {
     const snowcrash::Payload* p = AS_CTYPE(snowcrash::Payload, handle);
@@ -702,6 +711,15 @@ SC_API const char* sc_action_httpmethod(const sc_action_t* handle)
     return p->method.c_str();
 }
 
+SC_API sc_http_method_type sc_action_httpmethod_type(const sc_action_t* handle)
+{
+    const snowcrash::Action* p = AS_CTYPE(snowcrash::Action, handle);
+    if (!p)
+        return SC_UNDEFINED_HTTP_METHOD_TYPE;
+
+    return (sc_http_method_type)p->methodType;
+}
+
 SC_API const char* sc_action_name(const sc_action_t* handle)
 {
     const snowcrash::Action* p = AS_CTYPE(snowcrash::Action, handle);
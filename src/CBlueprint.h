@@ -24,7 +24,11 @@ extern "C" {
     enum sc_blueprint_parser_option {
         SC_RENDER_DESCRIPTIONS_OPTION = (1 << 0),       /// < Render Markdown in description.
         SC_REQUIRE_BLUEPRINT_NAME_OPTION = (1 << 1),    /// < Treat missing blueprint name as error
-        SC_EXPORT_SORUCEMAP_OPTION = (1 << 2)           /// < Export source maps AST
+        SC_EXPORT_SORUCEMAP_OPTION = (1 << 2),          /// < Export source maps AST
+        SC_SKIP_BODIES_OPTION = (1 << 3),               /// < Drop payload bodies from the AST
+        SC_SKIP_SCHEMAS_OPTION = (1 << 4),              /// < Drop payload schemas from the AST
+        SC_SKIP_DESCRIPTIONS_OPTION = (1 << 5),         /// < Drop descriptions from the AST
+        SC_SKIP_PARAMETERS_OPTION = (1 << 6)            /// < Drop URI parameters and their source maps from the AST
     };
 
     /** Parameter Use flag */
@@ -36,6 +40,27 @@ extern "C" {
         SC_WRITE_ONLY_PARAMETER_USE
     } sc_parameter_use;
 
+    /** HTTP Method type */
+    typedef enum sc_http_method_type {
+        SC_UNDEFINED_HTTP_METHOD_TYPE,
+        SC_GET_HTTP_METHOD_TYPE,
+        SC_POST_HTTP_METHOD_TYPE,
+        SC_PUT_HTTP_METHOD_TYPE,
+        SC_DELETE_HTTP_METHOD_TYPE,
+        SC_OPTIONS_HTTP_METHOD_TYPE,
+        SC_PATCH_HTTP_METHOD_TYPE,
+        SC_PROPPATCH_HTTP_METHOD_TYPE,
+        SC_LOCK_HTTP_METHOD_TYPE,
+        SC_UNLOCK_HTTP_METHOD_TYPE,
+        SC_COPY_HTTP_METHOD_TYPE,
+        SC_MOVE_HTTP_METHOD_TYPE,
+        SC_MKCOL_HTTP_METHOD_TYPE,
+        SC_HEAD_HTTP_METHOD_TYPE,
+        SC_LINK_HTTP_METHOD_TYPE,
+        SC_UNLINK_HTTP_METHOD_TYPE,
+        SC_CONNECT_HTTP_METHOD_TYPE
+    } sc_http_method_type;
+
     typedef enum sc_reference_type_t {
         SC_TYPE_SYMBOL_REFERENCE
     } sc_reference_type_t;
@@ -54,15 +79,15 @@ extern "C" {
 
     /** Class DataStructures wrapper */
     struct sc_data_structures_s;
-    typedef sc_data_structures_s sc_data_structures_t;
+    typedef struct sc_data_structures_s sc_data_structures_t;
 
     /** Array of DataStructure Collection wrapper */
     struct sc_data_structure_collection_s;
-    typedef sc_data_structure_collection_s sc_data_structure_collection_t;
+    typedef struct sc_data_structure_collection_s sc_data_structure_collection_t;
 
     /** Class DataStructure wrapper */
     struct sc_data_structure_s;
-    typedef sc_data_structure_s sc_data_structure_t;
+    typedef struct sc_data_structure_s sc_data_structure_t;
 
     /** Array Resource Group Collection wrapper */
     struct sc_resource_group_collection_s;
@@ -268,6 +293,9 @@ extern "C" {
     /** \returns Payload name */
     SC_API const char* sc_payload_name(const sc_payload_t* handle);
 
+    /** \returns Payload HTTP status code, 0 if not a response */
+    SC_API unsigned int sc_payload_status_code(const sc_payload_t* handle);
+
     /** \returns Payload description */
     SC_API const char* sc_payload_description(const sc_payload_t* handle);
 
@@ -396,6 +424,9 @@ extern "C" {
     /** \returns Action HTTPMethod */
     SC_API const char* sc_action_httpmethod(const sc_action_t* handle);
 
+    /** \returns Action HTTPMethod type */
+    SC_API sc_http_method_type sc_action_httpmethod_type(const sc_action_t* handle);
+
     /** \returns Action name */
     SC_API const char* sc_action_name(const sc_action_t* handle);
 
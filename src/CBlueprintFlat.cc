@@ -0,0 +1,471 @@
+//
+//  CBlueprintFlat.cc
+//  snowcrash
+//  C flat-array export of Blueprint.h and BlueprintSourcemap.h for binding purposes
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <map>
+#include "CBlueprintFlat.h"
+#include "snowcrash.h"
+
+using namespace snowcrash;
+
+/** Flat AST, see sc_flat_blueprint_t */
+struct sc_flat_blueprint_s {
+    std::vector<sc_flat_node_t> nodes;
+    std::vector<sc_flat_string_t> strings;
+    std::string blob;
+
+    /** Add a node, its fields are to be added before any other node */
+    size_t node(sc_flat_node_kind kind, size_t parent, int use = 0) {
+        sc_flat_node_t n;
+        n.kind = kind;
+        n.parent = parent;
+        n.fields = strings.size();
+        n.fields_size = 0;
+        n.use = use;
+        nodes.push_back(n);
+        return nodes.size() - 1;
+    }
+
+    /** Add a field to the last node */
+    void field(const std::string& value) {
+        sc_flat_string_t s;
+        s.offset = blob.length();
+        s.length = value.length();
+        strings.push_back(s);
+        blob += value;
+        nodes.back().fields_size++;
+    }
+};
+
+/** Flat source map, see sc_flat_sm_blueprint_t */
+struct sc_flat_sm_blueprint_s {
+    std::vector<sc_flat_node_t> nodes;
+    std::vector<sc_flat_source_map_t> sourceMaps;
+    std::vector<sc_flat_range_t> ranges;
+
+    /** Coalesced ranges of a source map */
+    typedef std::vector<std::pair<size_t, size_t> > RangesKey;
+
+    /** Index of the first range of every distinct source map in the range table */
+    std::map<RangesKey, size_t> distinct;
+
+    /** Ranges of the field being added */
+    RangesKey scratch;
+
+    /** Add a node, its fields are to be added before any other node */
+    size_t node(sc_flat_node_kind kind, size_t parent) {
+        sc_flat_node_t n;
+        n.kind = kind;
+        n.parent = parent;
+        n.fields = sourceMaps.size();
+        n.fields_size = 0;
+        n.use = 0;
+        nodes.push_back(n);
+        return nodes.size() - 1;
+    }
+
+    /** Add a field to the last node, its ranges are shared with identical source maps */
+    void field(const SourceMapBase& value) {
+        scratch.clear();
+
+        // Coalesce adjacent ranges
+        for (mdp::BytesRangeSet::const_iterator it = value.sourceMap.begin(); it != value.sourceMap.end(); ++it) {
+            if (!scratch.empty() && scratch.back().first + scratch.back().second == it->location)
+                scratch.back().second += it->length;
+            else
+                scratch.push_back(std::make_pair(it->location, it->length));
+        }
+
+        sc_flat_source_map_t sm;
+        sm.ranges = 0;
+        sm.ranges_size = scratch.size();
+
+        if (!scratch.empty()) {
+            std::map<RangesKey, size_t>::iterator found = distinct.find(scratch);
+
+            if (found != distinct.end()) {
+                sm.ranges = found->second;
+            }
+            else {
+                sm.ranges = ranges.size();
+                distinct.insert(std::make_pair(scratch, sm.ranges));
+
+                for (RangesKey::const_iterator it = scratch.begin(); it != scratch.end(); ++it) {
+                    sc_flat_range_t r;
+                    r.location = it->first;
+                    r.length = it->second;
+                    ranges.push_back(r);
+                }
+            }
+        }
+
+        sourceMaps.push_back(sm);
+        nodes.back().fields_size++;
+    }
+};
+
+/*----------------------------------------------------------------------*/
+
+static void FlattenKeyValues(const Collection<KeyValuePair>::type& pairs, sc_flat_node_kind kind, size_t parent, sc_flat_blueprint_s& flat)
+{
+    for (Collection<KeyValuePair>::const_iterator it = pairs.begin(); it != pairs.end(); ++it) {
+        flat.node(kind, parent);
+        flat.field(it->first);
+        flat.field(it->second);
+    }
+}
+
+static void FlattenParameters(const Parameters& parameters, sc_flat_node_kind kind, size_t parent, sc_flat_blueprint_s& flat)
+{
+    for (Collection<Parameter>::const_iterator it = parameters.begin(); it != parameters.end(); ++it) {
+        size_t n = flat.node(kind, parent, it->use);
+        flat.field(it->name);
+        flat.field(it->description);
+        flat.field(it->type);
+        flat.field(it->defaultValue);
+        flat.field(it->exampleValue);
+
+        for (Collection<Value>::const_iterator valueIt = it->values.begin(); valueIt != it->values.end(); ++valueIt) {
+            flat.node(SC_FLAT_VALUE, n);
+            flat.field(*valueIt);
+        }
+    }
+}
+
+static void FlattenPayload(const Payload& payload, sc_flat_node_kind kind, size_t parent, sc_flat_blueprint_s& flat)
+{
+    size_t n = flat.node(kind, parent);
+    flat.field(payload.name);
+    flat.field(payload.description);
+    flat.field(payload.body);
+    flat.field(payload.schema);
+    flat.field(payload.reference.id);
+
+    FlattenParameters(payload.parameters, SC_FLAT_PARAMETER, n, flat);
+    FlattenParameters(payload.attributes, SC_FLAT_ATTRIBUTE, n, flat);
+    FlattenKeyValues(payload.headers, SC_FLAT_HEADER, n, flat);
+}
+
+static void FlattenPayloads(const Collection<Payload>::type& payloads, sc_flat_node_kind kind, size_t parent, sc_flat_blueprint_s& flat)
+{
+    for (Collection<Payload>::const_iterator it = payloads.begin(); it != payloads.end(); ++it)
+        FlattenPayload(*it, kind, parent, flat);
+}
+
+static void FlattenAction(const Action& action, size_t parent, sc_flat_blueprint_s& flat)
+{
+    size_t n = flat.node(SC_FLAT_ACTION, parent);
+    flat.field(action.method);
+    flat.field(action.name);
+    flat.field(action.description);
+
+    FlattenParameters(action.parameters, SC_FLAT_PARAMETER, n, flat);
+    FlattenParameters(action.attributes, SC_FLAT_ATTRIBUTE, n, flat);
+    FlattenKeyValues(action.headers, SC_FLAT_HEADER, n, flat);
+
+    for (TransactionExamples::const_iterator it = action.examples.begin(); it != action.examples.end(); ++it) {
+        size_t example = flat.node(SC_FLAT_TRANSACTION_EXAMPLE, n);
+        flat.field(it->name);
+        flat.field(it->description);
+
+        FlattenPayloads(it->requests, SC_FLAT_REQUEST, example, flat);
+        FlattenPayloads(it->responses, SC_FLAT_RESPONSE, example, flat);
+    }
+}
+
+static void FlattenResource(const Resource& resource, size_t parent, sc_flat_blueprint_s& flat)
+{
+    size_t n = flat.node(SC_FLAT_RESOURCE, parent);
+    flat.field(resource.uriTemplate);
+    flat.field(resource.name);
+    flat.field(resource.description);
+
+    FlattenPayload(resource.model, SC_FLAT_MODEL, n, flat);
+    FlattenParameters(resource.parameters, SC_FLAT_PARAMETER, n, flat);
+    FlattenParameters(resource.attributes, SC_FLAT_ATTRIBUTE, n, flat);
+    FlattenKeyValues(resource.headers, SC_FLAT_HEADER, n, flat);
+
+    for (Actions::const_iterator it = resource.actions.begin(); it != resource.actions.end(); ++it)
+        FlattenAction(*it, n, flat);
+}
+
+static void FlattenBlueprint(const Blueprint& blueprint, sc_flat_blueprint_s& flat)
+{
+    size_t n = flat.node(SC_FLAT_BLUEPRINT, SC_FLAT_NO_PARENT);
+    flat.field(blueprint.name);
+    flat.field(blueprint.description);
+
+    FlattenKeyValues(blueprint.metadata, SC_FLAT_METADATA, n, flat);
+
+    for (ResourceGroups::const_iterator it = blueprint.resourceGroups.begin(); it != blueprint.resourceGroups.end(); ++it) {
+        size_t group = flat.node(SC_FLAT_RESOURCE_GROUP, n);
+        flat.field(it->name);
+        flat.field(it->description);
+
+        for (Resources::const_iterator resourceIt = it->resources.begin(); resourceIt != it->resources.end(); ++resourceIt)
+            FlattenResource(*resourceIt, group, flat);
+    }
+
+    size_t dataStructures = flat.node(SC_FLAT_DATA_STRUCTURES, n);
+    flat.field(blueprint.dataStructures.description);
+
+    for (DataStructureCollection::const_iterator it = blueprint.dataStructures.dataStructures.begin();
+         it != blueprint.dataStructures.dataStructures.end();
+         ++it) {
+
+        size_t dataStructure = flat.node(SC_FLAT_DATA_STRUCTURE, dataStructures);
+        flat.field(it->name);
+        flat.field(it->description);
+
+        FlattenParameters(it->members, SC_FLAT_ATTRIBUTE, dataStructure, flat);
+        FlattenPayload(it->sample, SC_FLAT_SAMPLE, dataStructure, flat);
+    }
+}
+
+/*----------------------------------------------------------------------*/
+
+static void FlattenKeyValues(const Collection<SourceMap<KeyValuePair> >::type& pairs, sc_flat_node_kind kind, size_t parent, sc_flat_sm_blueprint_s& flat)
+{
+    for (Collection<SourceMap<KeyValuePair> >::const_iterator it = pairs.begin(); it != pairs.end(); ++it) {
+        flat.node(kind, parent);
+        flat.field(*it);
+    }
+}
+
+static void FlattenParameters(const SourceMap<Parameters>& parameters, sc_flat_node_kind kind, size_t parent, sc_flat_sm_blueprint_s& flat)
+{
+    for (Collection<SourceMap<Parameter> >::const_iterator it = parameters.collection.begin(); it != parameters.collection.end(); ++it) {
+        size_t n = flat.node(kind, parent);
+        flat.field(it->name);
+        flat.field(it->description);
+        flat.field(it->type);
+        flat.field(it->defaultValue);
+        flat.field(it->exampleValue);
+        flat.field(it->use);
+
+        for (Collection<SourceMap<Value> >::const_iterator valueIt = it->values.collection.begin();
+             valueIt != it->values.collection.end();
+             ++valueIt) {
+
+            flat.node(SC_FLAT_VALUE, n);
+            flat.field(*valueIt);
+        }
+    }
+}
+
+static void FlattenPayload(const SourceMap<Payload>& payload, sc_flat_node_kind kind, size_t parent, sc_flat_sm_blueprint_s& flat)
+{
+    size_t n = flat.node(kind, parent);
+    flat.field(payload.name);
+    flat.field(payload.description);
+    flat.field(payload.body);
+    flat.field(payload.schema);
+    flat.field(payload.reference);
+
+    FlattenParameters(payload.parameters, SC_FLAT_PARAMETER, n, flat);
+    FlattenParameters(payload.attributes, SC_FLAT_ATTRIBUTE, n, flat);
+    FlattenKeyValues(payload.headers.collection, SC_FLAT_HEADER, n, flat);
+}
+
+static void FlattenPayloads(const Collection<SourceMap<Payload> >::type& payloads, sc_flat_node_kind kind, size_t parent, sc_flat_sm_blueprint_s& flat)
+{
+    for (Collection<SourceMap<Payload> >::const_iterator it = payloads.begin(); it != payloads.end(); ++it)
+        FlattenPayload(*it, kind, parent, flat);
+}
+
+static void FlattenAction(const SourceMap<Action>& action, size_t parent, sc_flat_sm_blueprint_s& flat)
+{
+    size_t n = flat.node(SC_FLAT_ACTION, parent);
+    flat.field(action.method);
+    flat.field(action.name);
+    flat.field(action.description);
+
+    FlattenParameters(action.parameters, SC_FLAT_PARAMETER, n, flat);
+    FlattenParameters(action.attributes, SC_FLAT_ATTRIBUTE, n, flat);
+    FlattenKeyValues(action.headers.collection, SC_FLAT_HEADER, n, flat);
+
+    for (Collection<SourceMap<TransactionExample> >::const_iterator it = action.examples.collection.begin();
+         it != action.examples.collection.end();
+         ++it) {
+
+        size_t example = flat.node(SC_FLAT_TRANSACTION_EXAMPLE, n);
+        flat.field(it->name);
+        flat.field(it->description);
+
+        FlattenPayloads(it->requests.collection, SC_FLAT_REQUEST, example, flat);
+        FlattenPayloads(it->responses.collection, SC_FLAT_RESPONSE, example, flat);
+    }
+}
+
+static void FlattenResource(const SourceMap<Resource>& resource, size_t parent, sc_flat_sm_blueprint_s& flat)
+{
+    size_t n = flat.node(SC_FLAT_RESOURCE, parent);
+    flat.field(resource.uriTemplate);
+    flat.field(resource.name);
+    flat.field(resource.description);
+
+    FlattenPayload(resource.model, SC_FLAT_MODEL, n, flat);
+    FlattenParameters(resource.parameters, SC_FLAT_PARAMETER, n, flat);
+    FlattenParameters(resource.attributes, SC_FLAT_ATTRIBUTE, n, flat);
+    FlattenKeyValues(resource.headers.collection, SC_FLAT_HEADER, n, flat);
+
+    for (Collection<SourceMap<Action> >::const_iterator it = resource.actions.collection.begin();
+         it != resource.actions.collection.end();
+         ++it) {
+
+        FlattenAction(*it, n, flat);
+    }
+}
+
+static void FlattenBlueprint(const SourceMap<Blueprint>& blueprint, sc_flat_sm_blueprint_s& flat)
+{
+    size_t n = flat.node(SC_FLAT_BLUEPRINT, SC_FLAT_NO_PARENT);
+    flat.field(blueprint.name);
+    flat.field(blueprint.description);
+
+    FlattenKeyValues(blueprint.metadata.collection, SC_FLAT_METADATA, n, flat);
+
+    for (Collection<SourceMap<ResourceGroup> >::const_iterator it = blueprint.resourceGroups.collection.begin();
+         it != blueprint.resourceGroups.collection.end();
+         ++it) {
+
+        size_t group = flat.node(SC_FLAT_RESOURCE_GROUP, n);
+        flat.field(it->name);
+        flat.field(it->description);
+
+        for (Collection<SourceMap<Resource> >::const_iterator resourceIt = it->resources.collection.begin();
+             resourceIt != it->resources.collection.end();
+             ++resourceIt) {
+
+            FlattenResource(*resourceIt, group, flat);
+        }
+    }
+
+    size_t dataStructures = flat.node(SC_FLAT_DATA_STRUCTURES, n);
+    flat.field(blueprint.dataStructures.description);
+
+    for (Collection<SourceMap<DataStructure> >::const_iterator it = blueprint.dataStructures.dataStructures.collection.begin();
+         it != blueprint.dataStructures.dataStructures.collection.end();
+         ++it) {
+
+        size_t dataStructure = flat.node(SC_FLAT_DATA_STRUCTURE, dataStructures);
+        flat.field(it->name);
+        flat.field(it->description);
+
+        FlattenParameters(it->members, SC_FLAT_ATTRIBUTE, dataStructure, flat);
+        FlattenPayload(it->sample, SC_FLAT_SAMPLE, dataStructure, flat);
+    }
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API sc_flat_blueprint_t* sc_flat_blueprint_new(const sc_blueprint_t* blueprint)
+{
+    const Blueprint* p = AS_CTYPE(Blueprint, blueprint);
+    if (!p)
+        return NULL;
+
+    sc_flat_blueprint_t* flat = ::new sc_flat_blueprint_t;
+    FlattenBlueprint(*p, *flat);
+
+    return flat;
+}
+
+SC_API void sc_flat_blueprint_free(sc_flat_blueprint_t* flat)
+{
+    ::delete flat;
+}
+
+SC_API size_t sc_flat_blueprint_nodes(const sc_flat_blueprint_t* flat, const sc_flat_node_t** nodes)
+{
+    if (!flat || flat->nodes.empty())
+        return 0;
+
+    if (nodes)
+        *nodes = &flat->nodes[0];
+
+    return flat->nodes.size();
+}
+
+SC_API size_t sc_flat_blueprint_strings(const sc_flat_blueprint_t* flat, const sc_flat_string_t** strings)
+{
+    if (!flat || flat->strings.empty())
+        return 0;
+
+    if (strings)
+        *strings = &flat->strings[0];
+
+    return flat->strings.size();
+}
+
+SC_API const char* sc_flat_blueprint_blob(const sc_flat_blueprint_t* flat, size_t* length)
+{
+    if (!flat)
+        return "";
+
+    if (length)
+        *length = flat->blob.length();
+
+    return flat->blob.data();
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API sc_flat_sm_blueprint_t* sc_flat_sm_blueprint_new(const sc_sm_blueprint_t* blueprint)
+{
+    const SourceMap<Blueprint>* p = AS_CTYPE(SourceMap<Blueprint>, blueprint);
+    if (!p)
+        return NULL;
+
+    sc_flat_sm_blueprint_t* flat = ::new sc_flat_sm_blueprint_t;
+    FlattenBlueprint(*p, *flat);
+
+    // Only needed while flattening
+    std::map<sc_flat_sm_blueprint_t::RangesKey, size_t>().swap(flat->distinct);
+    sc_flat_sm_blueprint_t::RangesKey().swap(flat->scratch);
+
+    return flat;
+}
+
+SC_API void sc_flat_sm_blueprint_free(sc_flat_sm_blueprint_t* flat)
+{
+    ::delete flat;
+}
+
+SC_API size_t sc_flat_sm_blueprint_nodes(const sc_flat_sm_blueprint_t* flat, const sc_flat_node_t** nodes)
+{
+    if (!flat || flat->nodes.empty())
+        return 0;
+
+    if (nodes)
+        *nodes = &flat->nodes[0];
+
+    return flat->nodes.size();
+}
+
+SC_API size_t sc_flat_sm_blueprint_source_maps(const sc_flat_sm_blueprint_t* flat, const sc_flat_source_map_t** source_maps)
+{
+    if (!flat || flat->sourceMaps.empty())
+        return 0;
+
+    if (source_maps)
+        *source_maps = &flat->sourceMaps[0];
+
+    return flat->sourceMaps.size();
+}
+
+SC_API size_t sc_flat_sm_blueprint_ranges(const sc_flat_sm_blueprint_t* flat, const sc_flat_range_t** ranges)
+{
+    if (!flat || flat->ranges.empty())
+        return 0;
+
+    if (ranges)
+        *ranges = &flat->ranges[0];
+
+    return flat->ranges.size();
+}
@@ -0,0 +1,150 @@
+//
+//  CBlueprintFlat.h
+//  snowcrash
+//  C flat-array export of Blueprint.h and BlueprintSourcemap.h for binding purposes
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SC_C_BLUEPRINT_FLAT_H
+#define SC_C_BLUEPRINT_FLAT_H
+
+#include "Platform.h"
+#include "stdlib.h"
+#include "CBlueprint.h"
+#include "CBlueprintSourcemap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /** Parent index of the root node */
+    #define SC_FLAT_NO_PARENT ((size_t)-1)
+
+    /**
+     *  brief Flat node kinds
+     *
+     *  Fields of the node kinds, in order:
+     *
+     *  - blueprint: name, description
+     *  - metadata, header: key, value
+     *  - data structures: description
+     *  - data structure, resource group, transaction example: name, description
+     *  - resource: URI template, name, description
+     *  - action: HTTP method, name, description
+     *  - request, response, model, sample: name, description, body, schema, reference id
+     *  - parameter, attribute: name, description, type, default value, example value
+     *  - value: value
+     *
+     *  Source map nodes have the same fields except for metadata and
+     *  headers with the source map of the whole key-value pair as their
+     *  only field and parameters and attributes with the parameter use
+     *  source map as an additional last field.
+     */
+    typedef enum sc_flat_node_kind {
+        SC_FLAT_BLUEPRINT,
+        SC_FLAT_METADATA,
+        SC_FLAT_DATA_STRUCTURES,
+        SC_FLAT_DATA_STRUCTURE,
+        SC_FLAT_RESOURCE_GROUP,
+        SC_FLAT_RESOURCE,
+        SC_FLAT_ACTION,
+        SC_FLAT_TRANSACTION_EXAMPLE,
+        SC_FLAT_REQUEST,
+        SC_FLAT_RESPONSE,
+        SC_FLAT_MODEL,
+        SC_FLAT_SAMPLE,
+        SC_FLAT_PARAMETER,
+        SC_FLAT_ATTRIBUTE,
+        SC_FLAT_VALUE,
+        SC_FLAT_HEADER
+    } sc_flat_node_kind;
+
+    /**
+     *  brief Flat AST node
+     *
+     *  Nodes are stored depth-first, a node precedes its children and
+     *  children keep their order in the AST. Every resource has a model
+     *  node, empty if the resource has no model. Data structure members
+     *  are attributes of the data structure.
+     */
+    typedef struct sc_flat_node_s {
+        sc_flat_node_kind kind;
+        size_t parent;          /// < Index of the parent node, SC_FLAT_NO_PARENT for the blueprint
+        size_t fields;          /// < Index of the first field of the node
+        size_t fields_size;     /// < Number of the fields of the node
+        int use;                /// < Parameter use of AST parameters and attributes, see sc_parameter_use
+    } sc_flat_node_t;
+
+    /** brief String in the flat AST blob */
+    typedef struct sc_flat_string_s {
+        size_t offset;
+        size_t length;
+    } sc_flat_string_t;
+
+    /**
+     *  brief Source map of a flat source map field, ranges in the range table
+     *
+     *  Adjacent ranges of a source map are coalesced and identical source
+     *  maps share their ranges in the range table, the ranges of a node's
+     *  fields are not necessarily stored one after another.
+     */
+    typedef struct sc_flat_source_map_s {
+        size_t ranges;          /// < Index of the first range
+        size_t ranges_size;     /// < Number of ranges
+    } sc_flat_source_map_t;
+
+    /** brief Source map range */
+    typedef struct sc_flat_range_s {
+        size_t location;
+        size_t length;
+    } sc_flat_range_t;
+
+    /** Class flat AST wrapper */
+    struct sc_flat_blueprint_s;
+    typedef struct sc_flat_blueprint_s sc_flat_blueprint_t;
+
+    /** Class flat source map wrapper */
+    struct sc_flat_sm_blueprint_s;
+    typedef struct sc_flat_sm_blueprint_s sc_flat_sm_blueprint_t;
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns pointer to allocated flat AST of the blueprint, the blueprint may be freed afterwards */
+    SC_API sc_flat_blueprint_t* sc_flat_blueprint_new(const sc_blueprint_t* blueprint);
+
+    /** \deallocate flat AST from pointer */
+    SC_API void sc_flat_blueprint_free(sc_flat_blueprint_t* flat);
+
+    /** \returns number of nodes, `nodes` set to the node table */
+    SC_API size_t sc_flat_blueprint_nodes(const sc_flat_blueprint_t* flat, const sc_flat_node_t** nodes);
+
+    /** \returns number of fields, `strings` set to the string table of the node fields */
+    SC_API size_t sc_flat_blueprint_strings(const sc_flat_blueprint_t* flat, const sc_flat_string_t** strings);
+
+    /** \returns blob of the strings, not NUL-terminated, `length` set to its length */
+    SC_API const char* sc_flat_blueprint_blob(const sc_flat_blueprint_t* flat, size_t* length);
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns pointer to allocated flat source map of the blueprint, the source map may be freed afterwards */
+    SC_API sc_flat_sm_blueprint_t* sc_flat_sm_blueprint_new(const sc_sm_blueprint_t* blueprint);
+
+    /** \deallocate flat source map from pointer */
+    SC_API void sc_flat_sm_blueprint_free(sc_flat_sm_blueprint_t* flat);
+
+    /** \returns number of nodes, `nodes` set to the node table */
+    SC_API size_t sc_flat_sm_blueprint_nodes(const sc_flat_sm_blueprint_t* flat, const sc_flat_node_t** nodes);
+
+    /** \returns number of fields, `source_maps` set to the source map table of the node fields */
+    SC_API size_t sc_flat_sm_blueprint_source_maps(const sc_flat_sm_blueprint_t* flat, const sc_flat_source_map_t** source_maps);
+
+    /** \returns number of ranges, `ranges` set to the range table */
+    SC_API size_t sc_flat_sm_blueprint_ranges(const sc_flat_sm_blueprint_t* flat, const sc_flat_range_t** ranges);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -9,6 +9,7 @@
 
 #include "CBlueprintSourcemap.h"
 #include "snowcrash.h"
+#include "CodeBlockUtility.h"
 
 SC_API size_t sc_source_map_size(const sc_source_map_t* source_map)
 {
@@ -37,6 +38,48 @@ SC_API size_t sc_source_map_location(const sc_source_map_t* source_map, size_t i
     return p->at(index).location;
 }
 
+SC_API const char* sc_source_map_asset_item(const sc_source_map_t* source_map, const char* source, size_t index, size_t* length)
+{
+    const mdp::BytesRangeSet* p = AS_CTYPE(mdp::BytesRangeSet, source_map);
+    if(!p || !source)
+        return NULL;
+
+    const mdp::BytesRange& range = p->at(index);
+    snowcrash::StringView item = snowcrash::CodeBlockUtility::assetRange(snowcrash::StringView(source + range.location, range.length));
+
+    if (length)
+        *length = item.length;
+
+    return item.data;
+}
+
+SC_API size_t sc_source_map_asset(const sc_source_map_t* source_map, const char* source, char* buffer, size_t size)
+{
+    const mdp::BytesRangeSet* p = AS_CTYPE(mdp::BytesRangeSet, source_map);
+    if(!p || !source)
+        return 0;
+
+    size_t length = 0;
+
+    for (size_t i = 0; i < p->size(); ++i) {
+
+        size_t itemLength;
+        const char* item = sc_source_map_asset_item(source_map, source, i, &itemLength);
+
+        if (buffer && length < size) {
+            size_t copied = std::min(itemLength, size - 1 - length);
+            std::copy(item, item + copied, buffer + length);
+        }
+
+        length += itemLength;
+    }
+
+    if (buffer && size)
+        buffer[std::min(length, size - 1)] = '\0';
+
+    return length;
+}
+
 /*----------------------------------------------------------------------*/
 
 SC_API sc_sm_blueprint_t* sc_sm_blueprint_new()
@@ -35,15 +35,15 @@ extern "C" {
 
     /** Class DataStructures source map wrapper */
     struct sc_sm_data_structures_s;
-    typedef sc_sm_data_structures_s sc_sm_data_structures_t;
+    typedef struct sc_sm_data_structures_s sc_sm_data_structures_t;
 
     /** Array of DataStructure Collection source map wrapper */
     struct sc_sm_data_structure_collection_s;
-    typedef sc_sm_data_structure_collection_s sc_sm_data_structure_collection_t;
+    typedef struct sc_sm_data_structure_collection_s sc_sm_data_structure_collection_t;
 
     /** Class DataStructure source map wrapper */
     struct sc_sm_data_structure_s;
-    typedef sc_sm_data_structure_s sc_sm_data_structure_t;
+    typedef struct sc_sm_data_structure_s sc_sm_data_structure_t;
 
     /** Array Resource Group Collection source map wrapper */
     struct sc_sm_resource_group_collection_s;
@@ -128,6 +128,28 @@ extern "C" {
     /** \returns Length of the source map item at index */
     SC_API size_t sc_source_map_location(const sc_source_map_t* source_map, size_t index);
 
+    /**
+     *  \brief Source of an asset source map item, without copying
+     *
+     *  Code block indentation of the item is skipped. Together with
+     *  SC_SKIP_BODIES_OPTION and SC_SKIP_SCHEMAS_OPTION fetches the
+     *  payload assets on demand, see sc_sm_payload_body().
+     *
+     *  \param source  The source the blueprint has been parsed from
+     *  \param length  Set to the length of the item
+     *  \returns Pointer to the item in the source
+     */
+    SC_API const char* sc_source_map_asset_item(const sc_source_map_t* source_map, const char* source, size_t index, size_t* length);
+
+    /**
+     *  \brief Materialize an asset from its source map
+     *  \param source  The source the blueprint has been parsed from
+     *  \param buffer  Buffer to copy the NUL-terminated asset into, NULL to measure the asset only
+     *  \param size    Size of the buffer, a longer asset is truncated
+     *  \returns Length of the asset, not including the terminating NUL
+     */
+    SC_API size_t sc_source_map_asset(const sc_source_map_t* source_map, const char* source, char* buffer, size_t size);
+
     /*----------------------------------------------------------------------*/
 
     /** \returns pointer to allocated Blueprint source map */
@@ -0,0 +1,48 @@
+//
+//  CCancellationToken.cc
+//  snowcrash
+//  C Implementation of CancellationToken.h for binding purposes
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "CCancellationToken.h"
+#include "CancellationToken.h"
+
+SC_API sc_cancellation_token_t* sc_cancellation_token_new()
+{
+    return AS_TYPE(sc_cancellation_token_t, ::new snowcrash::CancellationToken);
+}
+
+SC_API void sc_cancellation_token_free(sc_cancellation_token_t* token)
+{
+    ::delete AS_TYPE(snowcrash::CancellationToken, token);
+}
+
+SC_API void sc_cancellation_token_cancel(sc_cancellation_token_t* token)
+{
+    snowcrash::CancellationToken* p = AS_TYPE(snowcrash::CancellationToken, token);
+    if (!p)
+        return;
+
+    p->cancel();
+}
+
+SC_API void sc_cancellation_token_set_timeout(sc_cancellation_token_t* token, unsigned int milliseconds)
+{
+    snowcrash::CancellationToken* p = AS_TYPE(snowcrash::CancellationToken, token);
+    if (!p)
+        return;
+
+    p->setTimeout(milliseconds);
+}
+
+SC_API int sc_cancellation_token_is_cancelled(const sc_cancellation_token_t* token)
+{
+    const snowcrash::CancellationToken* p = AS_CTYPE(snowcrash::CancellationToken, token);
+    if (!p)
+        return 0;
+
+    return p->isCancelled() ? 1 : 0;
+}
@@ -0,0 +1,51 @@
+//
+//  CCancellationToken.h
+//  snowcrash
+//  C Implementation of CancellationToken.h for binding purposes
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SC_C_CANCELLATIONTOKEN_H
+#define SC_C_CANCELLATIONTOKEN_H
+
+#include "Platform.h"
+#include "stdlib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /** brief Error codes of a stopped parse */
+    enum sc_cancellation_error {
+        SC_CANCELLED_ERROR = 4,             /// < Parsing has been cancelled
+        SC_DEADLINE_EXCEEDED_ERROR = 5      /// < Parsing deadline has been exceeded
+    };
+
+    /** Class CancellationToken wrapper */
+    struct sc_cancellation_token_s;
+    typedef struct sc_cancellation_token_s sc_cancellation_token_t;
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns pointer to allocated CancellationToken*/
+    SC_API sc_cancellation_token_t* sc_cancellation_token_new();
+
+    /** \deallocate CancellationToken from pointer*/
+    SC_API void sc_cancellation_token_free(sc_cancellation_token_t* token);
+
+    /** \request cancellation, can be called from any thread*/
+    SC_API void sc_cancellation_token_cancel(sc_cancellation_token_t* token);
+
+    /** \set deadline `milliseconds` from now, 0 for no deadline*/
+    SC_API void sc_cancellation_token_set_timeout(sc_cancellation_token_t* token, unsigned int milliseconds);
+
+    /** \returns 1 if cancellation was requested, 0 otherwise*/
+    SC_API int sc_cancellation_token_is_cancelled(const sc_cancellation_token_t* token);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
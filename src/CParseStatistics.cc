@@ -0,0 +1,77 @@
+//
+//  CParseStatistics.cc
+//  snowcrash
+//  C Implementation of ParseStatistics.h for binding purposes
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include "CParseStatistics.h"
+#include "ParseStatistics.h"
+
+/** Copy `source` into `buffer` of `size`, \returns length of `source` */
+static size_t CopyToBuffer(const std::string& source, char* buffer, size_t size)
+{
+    if (buffer && size) {
+
+        size_t length = std::min(source.length(), size - 1);
+        ::memcpy(buffer, source.data(), length);
+        buffer[length] = '\0';
+    }
+
+    return source.length();
+}
+
+SC_API sc_parse_statistics_t* sc_parse_statistics_new()
+{
+    return AS_TYPE(sc_parse_statistics_t, ::new snowcrash::ParseStatistics);
+}
+
+SC_API void sc_parse_statistics_free(sc_parse_statistics_t* statistics)
+{
+    ::delete AS_TYPE(snowcrash::ParseStatistics, statistics);
+}
+
+SC_API void sc_parse_statistics_clear(sc_parse_statistics_t* statistics)
+{
+    snowcrash::ParseStatistics* p = AS_TYPE(snowcrash::ParseStatistics, statistics);
+    if (!p)
+        return;
+
+    p->clear();
+}
+
+SC_API int sc_parse_statistics_available()
+{
+    return snowcrash::ParseStatistics::isAvailable() ? 1 : 0;
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API size_t sc_parse_statistics_json(const sc_parse_statistics_t* statistics, char* buffer, size_t size)
+{
+    const snowcrash::ParseStatistics* p = AS_CTYPE(snowcrash::ParseStatistics, statistics);
+    if (!p)
+        return 0;
+
+    std::stringstream ss;
+    snowcrash::SerializeStatisticsJSON(*p, ss);
+
+    return CopyToBuffer(ss.str(), buffer, size);
+}
+
+SC_API size_t sc_parse_statistics_trace_json(const sc_parse_statistics_t* statistics, char* buffer, size_t size)
+{
+    const snowcrash::ParseStatistics* p = AS_CTYPE(snowcrash::ParseStatistics, statistics);
+    if (!p)
+        return 0;
+
+    std::stringstream ss;
+    snowcrash::SerializeTraceEventsJSON(*p, ss);
+
+    return CopyToBuffer(ss.str(), buffer, size);
+}
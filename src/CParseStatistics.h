@@ -0,0 +1,62 @@
+//
+//  CParseStatistics.h
+//  snowcrash
+//  C Implementation of ParseStatistics.h for binding purposes
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SC_C_PARSESTATISTICS_H
+#define SC_C_PARSESTATISTICS_H
+
+#include "Platform.h"
+#include "stdlib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /** Class ParseStatistics wrapper */
+    struct sc_parse_statistics_s;
+    typedef struct sc_parse_statistics_s sc_parse_statistics_t;
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns pointer to allocated ParseStatistics*/
+    SC_API sc_parse_statistics_t* sc_parse_statistics_new();
+
+    /** \deallocate ParseStatistics from pointer*/
+    SC_API void sc_parse_statistics_free(sc_parse_statistics_t* statistics);
+
+    /** \clear all collected data*/
+    SC_API void sc_parse_statistics_clear(sc_parse_statistics_t* statistics);
+
+    /** \returns 1 if the library was built with instrumentation, 0 otherwise*/
+    SC_API int sc_parse_statistics_available();
+
+    /*----------------------------------------------------------------------*/
+
+    /**
+     *  \brief Serialize counters and timers as JSON
+     *
+     *  Writes at most `size` bytes including the terminating zero into `buffer`.
+     *
+     *  \returns length of the complete JSON, excluding the terminating zero
+     */
+    SC_API size_t sc_parse_statistics_json(const sc_parse_statistics_t* statistics, char* buffer, size_t size);
+
+    /**
+     *  \brief Serialize trace spans as Chrome trace-event JSON
+     *
+     *  Writes at most `size` bytes including the terminating zero into `buffer`.
+     *
+     *  \returns length of the complete JSON, excluding the terminating zero
+     */
+    SC_API size_t sc_parse_statistics_trace_json(const sc_parse_statistics_t* statistics, char* buffer, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
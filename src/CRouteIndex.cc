@@ -0,0 +1,121 @@
+//
+//  CRouteIndex.cc
+//  snowcrash
+//  C Implementation of RouteIndex.h for binding purposes
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "CRouteIndex.h"
+#include "RouteIndex.h"
+
+SC_API sc_route_index_t* sc_route_index_new(const sc_blueprint_t* blueprint)
+{
+    snowcrash::RouteIndex* index = ::new snowcrash::RouteIndex;
+
+    const snowcrash::Blueprint* p = AS_CTYPE(snowcrash::Blueprint, blueprint);
+    if (p)
+        index->build(*p);
+
+    return AS_TYPE(sc_route_index_t, index);
+}
+
+SC_API void sc_route_index_free(sc_route_index_t* index)
+{
+    ::delete AS_TYPE(snowcrash::RouteIndex, index);
+}
+
+SC_API size_t sc_route_index_size(const sc_route_index_t* index)
+{
+    const snowcrash::RouteIndex* p = AS_CTYPE(snowcrash::RouteIndex, index);
+    if (!p)
+        return 0;
+
+    return p->size();
+}
+
+SC_API size_t sc_route_index_skipped(const sc_route_index_t* index)
+{
+    const snowcrash::RouteIndex* p = AS_CTYPE(snowcrash::RouteIndex, index);
+    if (!p)
+        return 0;
+
+    return p->skipped();
+}
+
+SC_API int sc_route_index_match(const sc_route_index_t* index, const char* method, const char* path, sc_route_match_t* match)
+{
+    const snowcrash::RouteIndex* p = AS_CTYPE(snowcrash::RouteIndex, index);
+    snowcrash::RouteMatch* m = AS_TYPE(snowcrash::RouteMatch, match);
+    if (!p || !m || !method || !path)
+        return 0;
+
+    return p->match(method, path, *m) ? 1 : 0;
+}
+
+/*----------------------------------------------------------------------*/
+
+SC_API sc_route_match_t* sc_route_match_new()
+{
+    return AS_TYPE(sc_route_match_t, ::new snowcrash::RouteMatch);
+}
+
+SC_API void sc_route_match_free(sc_route_match_t* match)
+{
+    ::delete AS_TYPE(snowcrash::RouteMatch, match);
+}
+
+SC_API const sc_resource_group_t* sc_route_match_resource_group(const sc_route_match_t* match)
+{
+    const snowcrash::RouteMatch* p = AS_CTYPE(snowcrash::RouteMatch, match);
+    if (!p)
+        return NULL;
+
+    return AS_CTYPE(sc_resource_group_t, p->resourceGroup);
+}
+
+SC_API const sc_resource_t* sc_route_match_resource(const sc_route_match_t* match)
+{
+    const snowcrash::RouteMatch* p = AS_CTYPE(snowcrash::RouteMatch, match);
+    if (!p)
+        return NULL;
+
+    return AS_CTYPE(sc_resource_t, p->resource);
+}
+
+SC_API const sc_action_t* sc_route_match_action(const sc_route_match_t* match)
+{
+    const snowcrash::RouteMatch* p = AS_CTYPE(snowcrash::RouteMatch, match);
+    if (!p)
+        return NULL;
+
+    return AS_CTYPE(sc_action_t, p->action);
+}
+
+SC_API size_t sc_route_match_variables_size(const sc_route_match_t* match)
+{
+    const snowcrash::RouteMatch* p = AS_CTYPE(snowcrash::RouteMatch, match);
+    if (!p)
+        return 0;
+
+    return p->variables.size();
+}
+
+SC_API const char* sc_route_match_variable_name(const sc_route_match_t* match, size_t index)
+{
+    const snowcrash::RouteMatch* p = AS_CTYPE(snowcrash::RouteMatch, match);
+    if (!p)
+        return "";
+
+    return p->variables.at(index).first.c_str();
+}
+
+SC_API const char* sc_route_match_variable_value(const sc_route_match_t* match, size_t index)
+{
+    const snowcrash::RouteMatch* p = AS_CTYPE(snowcrash::RouteMatch, match);
+    if (!p)
+        return "";
+
+    return p->variables.at(index).second.c_str();
+}
@@ -0,0 +1,84 @@
+//
+//  CRouteIndex.h
+//  snowcrash
+//  C Implementation of RouteIndex.h for binding purposes
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SC_C_ROUTEINDEX_H
+#define SC_C_ROUTEINDEX_H
+
+#include "Platform.h"
+#include "stdlib.h"
+#include "CBlueprint.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /** Class RouteIndex wrapper */
+    struct sc_route_index_s;
+    typedef struct sc_route_index_s sc_route_index_t;
+
+    /** Struct RouteMatch wrapper */
+    struct sc_route_match_s;
+    typedef struct sc_route_match_s sc_route_match_t;
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns pointer to allocated RouteIndex of all actions in blueprint, blueprint must outlive it*/
+    SC_API sc_route_index_t* sc_route_index_new(const sc_blueprint_t* blueprint);
+
+    /** \deallocate RouteIndex from pointer*/
+    SC_API void sc_route_index_free(sc_route_index_t* index);
+
+    /** \returns number of indexed actions*/
+    SC_API size_t sc_route_index_size(const sc_route_index_t* index);
+
+    /** \returns number of actions left out, unsupported or duplicate*/
+    SC_API size_t sc_route_index_skipped(const sc_route_index_t* index);
+
+    /**
+     *  \brief Resolve a request
+     *
+     *  \param method   HTTP method of the request
+     *  \param path     request path, optionally followed by a query string
+     *  \param match    match to store the action and variables into
+     *
+     *  \returns 1 if an action has been found, 0 otherwise
+     */
+    SC_API int sc_route_index_match(const sc_route_index_t* index, const char* method, const char* path, sc_route_match_t* match);
+
+    /*----------------------------------------------------------------------*/
+
+    /** \returns pointer to allocated RouteMatch*/
+    SC_API sc_route_match_t* sc_route_match_new();
+
+    /** \deallocate RouteMatch from pointer*/
+    SC_API void sc_route_match_free(sc_route_match_t* match);
+
+    /** \returns matched resource group handle, NULL if not matched*/
+    SC_API const sc_resource_group_t* sc_route_match_resource_group(const sc_route_match_t* match);
+
+    /** \returns matched resource handle, NULL if not matched*/
+    SC_API const sc_resource_t* sc_route_match_resource(const sc_route_match_t* match);
+
+    /** \returns matched action handle, NULL if not matched*/
+    SC_API const sc_action_t* sc_route_match_action(const sc_route_match_t* match);
+
+    /** \returns number of extracted variables*/
+    SC_API size_t sc_route_match_variables_size(const sc_route_match_t* match);
+
+    /** \returns name of variable at `index`*/
+    SC_API const char* sc_route_match_variable_name(const sc_route_match_t* match, size_t index);
+
+    /** \returns value of variable at `index`, not percent-decoded*/
+    SC_API const char* sc_route_match_variable_value(const sc_route_match_t* match, size_t index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
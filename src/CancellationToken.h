@@ -0,0 +1,72 @@
+//
+//  CancellationToken.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_CANCELLATIONTOKEN_H
+#define SNOWCRASH_CANCELLATIONTOKEN_H
+
+#include <stdexcept>
+#include <string>
+#include "SourceAnnotation.h"
+
+namespace snowcrash {
+
+    /**
+     *  \brief Parse cancellation exception
+     *
+     *  Thrown at a node boundary once the parsing is cancelled
+     *  or its deadline has passed. Caught by snowcrash::parse().
+     */
+    struct CancellationException : public std::runtime_error {
+
+        CancellationException(const std::string& message, ErrorCode code_)
+        : std::runtime_error(message), code(code_) {}
+
+        /** Either CancelledError or DeadlineExceededError */
+        ErrorCode code;
+    };
+
+    /**
+     *  \brief Cooperative parse cancellation token
+     *
+     *  The parser checks the token at Markdown node boundaries. The token
+     *  can be cancelled from any thread while a parse is in progress.
+     */
+    class CancellationToken {
+    public:
+
+        CancellationToken() : m_cancelled(0), m_deadline(0) {}
+
+        /** Request cancellation of parsing, may be called from any thread */
+        void cancel();
+
+        /** \returns True if cancellation was requested */
+        bool isCancelled() const;
+
+        /**
+         *  \brief Set deadline relative to now
+         *
+         *  Unlike cancel(), the deadline must be set before the token is
+         *  passed to a parse.
+         *
+         *  \param milliseconds Time parsing is allowed to take, 0 for no deadline
+         */
+        void setTimeout(unsigned int milliseconds);
+
+        /** \returns True if there is a deadline and it has passed */
+        bool isExpired() const;
+
+        /** Throw CancellationException if parsing should stop */
+        void check() const;
+
+    private:
+        long m_cancelled;   /// < Accessed atomically only
+        double m_deadline;  /// < Deadline in milliseconds, 0 for none
+    };
+}
+
+#endif
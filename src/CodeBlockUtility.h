@@ -45,28 +45,101 @@ namespace snowcrash {
             }
         }
 
+        /**
+         *  \brief  Append source data of a Markdown node without an intermediate copy.
+         *  \param  sourceMap   Source map of the node
+         *  \param  sourceData  Source data the map points into
+         *  \param  content     The string to append to
+         */
+        static void appendSourceData(const mdp::BytesRangeSet& sourceMap,
+                                     const mdp::ByteBuffer& sourceData,
+                                     mdp::ByteBuffer& content) {
+
+            for (mdp::BytesRangeSet::const_iterator it = sourceMap.begin();
+                 it != sourceMap.end();
+                 ++it) {
+
+                // Stop at a range out of the source data
+                if (it->location + it->length > sourceData.length())
+                    return;
+
+                content.append(sourceData, it->location, it->length);
+            }
+        }
+
+        /**
+         *  \brief  View of an asset source map range without its code block indentation.
+         *
+         *  Source map ranges of a code block start one indentation level
+         *  (4 spaces or a tab) before the code. Ranges of other blocks start
+         *  at the text and are viewed as they are.
+         *
+         *  \param  range   Source of the range
+         *  \return The range as it appears in the asset
+         */
+        static StringView assetRange(StringView range) {
+
+            if (range.length && range[0] == '\t')
+                return StringView(range.data + 1, range.length - 1);
+
+            if (range.length >= 4 && std::count(range.begin(), range.begin() + 4, ' ') == 4)
+                return StringView(range.data + 4, range.length - 4);
+
+            return range;
+        }
+
+        /**
+         *  \brief  Materialize an asset from its source map, e.g. a body dropped by `SkipBodiesOption`.
+         *
+         *  The materialized asset matches the parsed asset except for the
+         *  trailing line feeds appended to dangling assets.
+         *
+         *  \param  sourceMap   Source map of the asset
+         *  \param  sourceData  Source data the map points into
+         *  \param  asset       The string to append the asset to
+         */
+        static void appendAsset(const mdp::BytesRangeSet& sourceMap,
+                                const mdp::ByteBuffer& sourceData,
+                                mdp::ByteBuffer& asset) {
+
+            for (mdp::BytesRangeSet::const_iterator it = sourceMap.begin();
+                 it != sourceMap.end();
+                 ++it) {
+
+                // Stop at a range out of the source data
+                if (it->location + it->length > sourceData.length())
+                    return;
+
+                StringView range = assetRange(StringView(sourceData.data() + it->location, it->length));
+                asset.append(range.data, range.length);
+            }
+        }
+
         /**
          *  \brief  Retrieve the textual content of a Markdown node as if it was a code block.
          *  \param  pd      Parser status
          *  \param  report  Report log
-         *  \param  conten  The content retrieved
+         *  \param  conten  The content retrieved, appended to, NULL to only check the node
+         *  \return True if the node has any content
          */
-        static void contentAsCodeBlock(const MarkdownNodeIterator& node,
+        static bool contentAsCodeBlock(const MarkdownNodeIterator& node,
                                        const SectionParserData& pd,
                                        Report& report,
-                                       mdp::ByteBuffer& content) {
+                                       mdp::ByteBuffer* content) {
 
             checkPossibleReference(node, pd, report);
 
             if (node->type == mdp::CodeMarkdownNodeType) {
-                content += node->text;
+                if (content)
+                    *content += node->text;
 
                 checkExcessiveIndentation(node, pd, report);
-                return;
+                return !node->text.empty();
             }
 
             // Other blocks, process & warn
-            content += mdp::MapBytesRangeSet(node->sourceMap, pd.sourceData);
+            if (content)
+                appendSourceData(node->sourceMap, pd.sourceData, *content);
 
             // WARN: Not a preformatted code block
             size_t level = codeBlockIndentationLevel(pd.parentSectionContext());
@@ -84,22 +157,29 @@ namespace snowcrash {
             report.warnings.push_back(Warning(ss.str(),
                                               IndentationWarning,
                                               sourceMap));
+
+            return pd.hasSourceData(node->sourceMap);
         }
 
-        /** \brief  Retrieve the textual content of a signature markdown */
-        static void signatureContentAsCodeBlock(const MarkdownNodeIterator& node,
+        /**
+         *  \brief  Retrieve the textual content of a signature markdown
+         *  \param  content The content retrieved, appended to, NULL to only check the node
+         *  \return True if the signature has any content
+         */
+        static bool signatureContentAsCodeBlock(const MarkdownNodeIterator& node,
                                                 const SectionParserData& pd,
                                                 Report& report,
-                                                mdp::ByteBuffer& content) {
+                                                mdp::ByteBuffer* content) {
 
-            mdp::ByteBuffer remainingContent;
-            GetFirstLine(node->text, remainingContent);
+            size_t firstLineEnd = node->text.find('\n');
 
-            if (remainingContent.empty())
-                return;
+            if (firstLineEnd == mdp::ByteBuffer::npos || firstLineEnd + 1 == node->text.length())
+                return false;
 
-            content += remainingContent;
-            content += "\n";
+            if (content) {
+                content->append(node->text, firstLineEnd + 1, mdp::ByteBuffer::npos);
+                *content += "\n";
+            }
 
             // WARN: Not a preformatted code block but multiline signature
             size_t level = codeBlockIndentationLevel(pd.parentSectionContext());
@@ -119,6 +199,8 @@ namespace snowcrash {
             report.warnings.push_back(Warning(ss.str(),
                                               IndentationWarning,
                                               sourceMap));
+
+            return true;
         }
 
         /**
@@ -130,18 +212,31 @@ namespace snowcrash {
                                               Report& report) {
 
             // Check for possible superfluous indentation of a recognized list items.
-            mdp::ByteBuffer r;
-            mdp::ByteBuffer line = GetFirstLine(node->text, r);
-            TrimString(line);
+            const mdp::ByteBuffer& text = node->text;
+            size_t begin = 0;
+            size_t end = text.find('\n');
+
+            if (end == mdp::ByteBuffer::npos)
+                end = text.length();
+
+            while (begin < end && isSpace(text[begin]))
+                ++begin;
 
             // If line appears to be a Markdown list.
-            if (line.empty() ||
-                (line[0] != '-' && line[0] != '+' && line[0] != '*'))
+            if (begin == end ||
+                (text[begin] != '-' && text[begin] != '+' && text[begin] != '*'))
                 return false;
 
             // Skip leading Markdown list item mark
-            std::string signature = line.substr(1, std::string::npos);
-            TrimStringStart(signature);
+            ++begin;
+
+            while (begin < end && isSpace(text[begin]))
+                ++begin;
+
+            while (end > begin && isSpace(text[end - 1]))
+                --end;
+
+            std::string signature(text, begin, end - begin);
 
             SectionType type = RecognizeCodeBlockFirstLine(signature);
 
@@ -182,42 +277,54 @@ namespace snowcrash {
          *  \param  keyValuePair    The output buffer to place the parsed data into
          *  \return True on success, false otherwise
          */
-        static bool keyValueFromLine(const mdp::ByteBuffer& line,
-                                    KeyValuePair& keyValuePair) {
+        static bool keyValueFromLine(const StringView& line,
+                                     KeyValuePair& keyValuePair) {
 
-            std::vector<std::string> rawMetadata = SplitOnFirst(line, ':');
-            if (rawMetadata.size() != 2)
+            StringView key, value;
+
+            if (!SplitKeyValue(line, ':', key, value) || key.empty() || value.empty())
                 return false;
 
-            keyValuePair = std::make_pair(rawMetadata[0], rawMetadata[1]);
-            TrimString(keyValuePair.first);
-            TrimString(keyValuePair.second);
+            keyValuePair.first.assign(key.data, key.length);
+            keyValuePair.second.assign(value.data, value.length);
+
+            return true;
+        }
+
+        static bool keyValueFromLine(const mdp::ByteBuffer& line,
+                                     KeyValuePair& keyValuePair) {
 
-            return (!keyValuePair.first.empty() && !keyValuePair.second.empty());
+            return keyValueFromLine(StringView(line), keyValuePair);
         }
 
         /**
          *  \brief Add dangling message body asset to the given string
-         *  \param  out  The string to which the dangling asset should be added
-         *  \param  outSM The source map to which source map should be added
-         *  \return asset The value of the asset
+         *  \param  out  The string to which the dangling asset should be added, NULL to only check the asset
+         *  \return True if a non-empty asset has been added
          */
-        static mdp::ByteBuffer addDanglingAsset(const MarkdownNodeIterator& node,
-                                                SectionParserData& pd,
-                                                SectionType& sectionType,
-                                                Report& report,
-                                                mdp::ByteBuffer& out) {
+        static bool addDanglingAsset(const MarkdownNodeIterator& node,
+                                     SectionParserData& pd,
+                                     SectionType& sectionType,
+                                     Report& report,
+                                     mdp::ByteBuffer* out) {
 
-            mdp::ByteBuffer asset;
+            bool added;
 
             if (node->type == mdp::CodeMarkdownNodeType) {
-                asset = node->text;
+                added = !node->text.empty();
+
+                if (out)
+                    *out += node->text;
             } else {
-                asset = mdp::MapBytesRangeSet(node->sourceMap, pd.sourceData);
+                added = pd.hasSourceData(node->sourceMap);
+
+                if (out)
+                    appendSourceData(node->sourceMap, pd.sourceData, *out);
             }
 
-            TwoNewLines(asset);
-            out += asset;
+            if (added && out) {
+                TwoNewLines(*out);
+            }
 
             size_t level = CodeBlockUtility::codeBlockIndentationLevel(sectionType);
 
@@ -238,7 +345,7 @@ namespace snowcrash {
                                                   sourceMap));
             }
 
-            return asset;
+            return added;
         }
 
         /**
@@ -249,12 +356,11 @@ namespace snowcrash {
                                            const SectionParserData& pd,
                                            Report& report) {
 
-            mdp::ByteBuffer source = node->text;
-            Identifier symbol;
+            mdp::BytesRange range;
 
-            TrimString(source);
+            if (FindSymbolReference(node->text, range)) {
 
-            if(GetSymbolReference(source, symbol)) {
+                Identifier symbol(node->text, range.location, range.length);
 
                 std::stringstream ss;
                 ss << "found a possible '" << symbol << "' model reference, ";
@@ -13,21 +13,19 @@
 #include "SectionParser.h"
 #include "ParametersParser.h"
 #include "PayloadParser.h"
+#include "HeaderSignature.h"
 #include "RegexMatch.h"
 
 namespace snowcrash {
 
-    /** Keyword Data Structure matching regex */
-    const char* const KeywordDataStructureHeaderRegex = "^[[:blank:]]*[Ss]tructure[[:blank:]]+" SYMBOL_IDENTIFIER "[[:blank:]]*$";
-
     /** Internal type alias for Collection iterator of DataStructure */
     typedef Collection<DataStructure>::const_iterator DataStructuresIterator;
 
     /**
      * Data Structure Section processor
      */
-    template<>
-    struct SectionProcessor<DataStructure> : public SectionProcessorBase<DataStructure> {
+    template<typename SourceMapPolicy>
+    struct SectionProcessor<DataStructure, SourceMapPolicy> : public SectionProcessorBase<DataStructure, SourceMapPolicy> {
 
         static MarkdownNodeIterator processSignature(const MarkdownNodeIterator& node,
                                                      const MarkdownNodes& siblings,
@@ -35,28 +33,28 @@ namespace snowcrash {
                                                      SectionLayout& layout,
                                                      const ParseResultRef<DataStructure>& out) {
 
-            CaptureGroups captureGroups;
+            HeaderSignature signature;
             mdp::ByteBuffer subject, remaining;
 
             subject = GetFirstLine(node->text, remaining);
             TrimString(subject);
-            
-            if (RegexCapture(subject, KeywordDataStructureHeaderRegex, captureGroups, 3)) {
-                out.node.name = captureGroups[1];
-            }
 
-            TrimString(out.node.name);
+            if (ScanDataStructureHeader(subject, signature)) {
+                out.node.name = HeaderSignature::part(subject, signature.name);
+            }
 
-            if (pd.exportSourceMap()) {
+            if (SourceMapPolicy::exportSourceMap(pd)) {
                 if (!out.node.name.empty()) {
                     out.sourceMap.name.sourceMap = node->sourceMap;
                 }
             }
 
             if (!remaining.empty()) {
-                out.node.description += remaining;
 
-                if (pd.exportSourceMap()) {
+                if (!pd.skip(SkipDescriptionsOption))
+                    out.node.description += remaining;
+
+                if (SourceMapPolicy::exportSourceMap(pd) || pd.skip(SkipDescriptionsOption)) {
                     out.sourceMap.description.sourceMap.append(node->sourceMap);
                 }
             }
@@ -79,7 +77,7 @@ namespace snowcrash {
                 case MembersSectionType:
                 {
                     ParseResultRef<Parameters> parameters(out.report, out.node.members, out.sourceMap.members);
-                    return ParametersParser::parse(node, siblings, pd, parameters);
+                    return SectionParser<Parameters, ListSectionAdapter, SourceMapPolicy>::parse(node, siblings, pd, parameters);
                 }
 
                 case SampleSectionType:
@@ -87,13 +85,18 @@ namespace snowcrash {
                 {
                     IntermediateParseResult<Payload> payload(out.report);
 
-                    cur = PayloadParser::parse(node, siblings, pd, payload);
+                    cur = SectionParser<Payload, ListSectionAdapter, SourceMapPolicy>::parse(node, siblings, pd, payload);
+
+                    checkPayload(sectionType, sourceMap, payload.node, pd, out);
 
-                    checkPayload(sectionType, sourceMap, payload.node, out);
+                    if (pd.skip(SkipParametersOption)) {
+                        payload.node.parameters.clear();
+                        payload.sourceMap.parameters.collection.clear();
+                    }
 
                     out.node.sample = payload.node;
 
-                    if (pd.exportSourceMap()) {
+                    if (SourceMapPolicy::exportSourceMap(pd) || pd.skip(SkipBodiesOption)) {
                         out.sourceMap.sample = payload.sourceMap;
                     }
 
@@ -110,11 +113,11 @@ namespace snowcrash {
         static bool isUnexpectedNode(const MarkdownNodeIterator& node,
                                      SectionType sectionType) {
 
-            if (SectionProcessor<Asset>::sectionType(node) != UndefinedSectionType) {
+            if (SectionProcessor<Asset, SourceMapPolicy>::sectionType(node) != UndefinedSectionType) {
                 return true;
             }
 
-            return SectionProcessorBase<DataStructure>::isUnexpectedNode(node, sectionType);
+            return SectionProcessorBase<DataStructure, SourceMapPolicy>::isUnexpectedNode(node, sectionType);
         }
 
         static MarkdownNodeIterator processUnexpectedNode(const MarkdownNodeIterator& node,
@@ -123,7 +126,7 @@ namespace snowcrash {
                                                           SectionType& sectionType,
                                                           const ParseResultRef<DataStructure>& out) {
 
-            SectionType assetType = SectionProcessor<Asset>::sectionType(node);
+            SectionType assetType = SectionProcessor<Asset, SourceMapPolicy>::sectionType(node);
 
             if (assetType != UndefinedSectionType) {
 
@@ -141,7 +144,7 @@ namespace snowcrash {
                 return ++MarkdownNodeIterator(node);
             }
 
-            return SectionProcessorBase<DataStructure>::processUnexpectedNode(node, siblings, pd, sectionType, out);
+            return SectionProcessorBase<DataStructure, SourceMapPolicy>::processUnexpectedNode(node, siblings, pd, sectionType, out);
         }
 
         static SectionType sectionType(const MarkdownNodeIterator& node) {
@@ -149,10 +152,11 @@ namespace snowcrash {
             if (node->type == mdp::HeaderMarkdownNodeType
                 && !node->text.empty()) {
 
+                HeaderSignature signature;
                 mdp::ByteBuffer subject = node->text;
                 TrimString(subject);
 
-                if (RegexMatch(subject, KeywordDataStructureHeaderRegex)) {
+                if (ScanDataStructureHeader(subject, signature)) {
 
                     return DataStructureSectionType;
                 }
@@ -166,14 +170,14 @@ namespace snowcrash {
             SectionType nestedType = UndefinedSectionType;
 
             // Check if parameters section
-            nestedType = SectionProcessor<Parameters>::sectionType(node);
+            nestedType = SectionProcessor<Parameters, SourceMapPolicy>::sectionType(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if payload section
-            nestedType = SectionProcessor<Payload>::sectionType(node);
+            nestedType = SectionProcessor<Payload, SourceMapPolicy>::sectionType(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
@@ -189,7 +193,7 @@ namespace snowcrash {
             nested.push_back(SampleBodySectionType);
             nested.push_back(SampleSectionType);
 
-            types = SectionProcessor<Payload>::nestedSectionTypes();
+            types = SectionProcessor<Payload, SourceMapPolicy>::nestedSectionTypes();
             nested.insert(nested.end(), types.begin(), types.end());
 
             return nested;
@@ -205,15 +209,17 @@ namespace snowcrash {
          *  \param  sectionType A section of the payload.
          *  \param  sourceMap   Payload signature source map.
          *  \param  payload     The payload to be checked.
+         *  \param  pd          Section parser state.
          *  \param  out         The Data Structure to which payload belongs to.
          */
         static void checkPayload(SectionType sectionType,
                                  const mdp::CharactersRangeSet sourceMap,
                                  const Payload& payload,
+                                 const SectionParserData& pd,
                                  const ParseResultRef<DataStructure>& out) {
 
 
-            if (!out.node.sample.body.empty()) {
+            if (SectionProcessor<Payload, SourceMapPolicy>::hasBody(pd, out.node.sample, out.sourceMap.sample)) {
 
                 // WARN: Duplicate payload
                 std::stringstream ss;
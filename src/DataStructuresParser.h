@@ -15,16 +15,14 @@
 
 namespace snowcrash {
 
-    const char* const DataStructuresHeaderRegex = "^[[:blank:]]*[Dd]ata[[:blank:]]+[Ss]tructures[[:blank:]]*$";
-
     /** Internal type alias for Collection iterator of DataStructure */
     typedef Collection<DataStructure>::const_iterator DataStructureIterator;
 
     /**
      * DataStructures Section processor
      */
-    template<>
-    struct SectionProcessor<DataStructures> : public SectionProcessorBase<DataStructures> {
+    template<typename SourceMapPolicy>
+    struct SectionProcessor<DataStructures, SourceMapPolicy> : public SectionProcessorBase<DataStructures, SourceMapPolicy> {
 
         static MarkdownNodeIterator processSignature(const MarkdownNodeIterator& node,
                                                      const MarkdownNodes& siblings,
@@ -54,7 +52,7 @@ namespace snowcrash {
 
                 IntermediateParseResult<DataStructure> ds(out.report);
 
-                MarkdownNodeIterator cur = DataStructureParser::parse(node, siblings, pd, ds);
+                MarkdownNodeIterator cur = SectionParser<DataStructure, HeaderSectionAdapter, SourceMapPolicy>::parse(node, siblings, pd, ds);
 
                 DataStructureIterator duplicate = findDataStructure(out.node.dataStructures, ds.node);
 
@@ -68,7 +66,7 @@ namespace snowcrash {
 
                 out.node.dataStructures.push_back(ds.node);
 
-                if (pd.exportSourceMap()) {
+                if (SourceMapPolicy::exportSourceMap(pd)) {
                     out.sourceMap.dataStructures.collection.push_back(ds.sourceMap);
                 }
 
@@ -92,10 +90,9 @@ namespace snowcrash {
             if (node->type == mdp::HeaderMarkdownNodeType
                 && !node->text.empty()) {
 
-                mdp::ByteBuffer subject = node->text;
-                TrimString(subject);
+                StringView subject = TrimView(StringView(node->text));
 
-                if (RegexMatch(subject, DataStructuresHeaderRegex)) {
+                if (MatchSectionKeyword(subject, "Data Structures")) {
                     return DataStructuresSectionType;
                 }
             }
@@ -106,7 +103,7 @@ namespace snowcrash {
         static SectionType nestedSectionType(const MarkdownNodeIterator& node) {
 
             // Return DataStructureSectionType or UndefinedSectionType
-            return SectionProcessor<DataStructure>::sectionType(node);
+            return SectionProcessor<DataStructure, SourceMapPolicy>::sectionType(node);
         }
 
         static SectionTypes nestedSectionTypes() {
@@ -114,7 +111,7 @@ namespace snowcrash {
 
             // DataStructure & descendants
             nested.push_back(DataStructureSectionType);
-            SectionTypes types = SectionProcessor<DataStructure>::nestedSectionTypes();
+            SectionTypes types = SectionProcessor<DataStructure, SourceMapPolicy>::nestedSectionTypes();
             nested.insert(nested.end(), types.begin(), types.end());
 
             return nested;
@@ -21,6 +21,73 @@ const std::string HTTPHeaderName::Link = "Link";
 const std::string HTTPMethodName::Head = "HEAD";
 const std::string HTTPMethodName::Connect = "CONNECT";
 
+namespace {
+
+    /** Method of the HTTP methods table */
+    struct HTTPMethodEntry {
+        const char* name;
+        bool allowBody;
+    };
+
+    /**
+     *  HTTP methods table, indexed by %HTTPMethodType
+     *
+     *  Following HTTP methods MUST NOT contain response body: HEAD, CONNECT
+     *  FIXME: When refactoring traits don't forget that 'CONNECT' has no body only when 1xx-2xx
+     */
+    const HTTPMethodEntry HTTPMethods[] = {
+        { "", true },
+        { "GET", true },
+        { "POST", true },
+        { "PUT", true },
+        { "DELETE", true },
+        { "OPTIONS", true },
+        { "PATCH", true },
+        { "PROPPATCH", true },
+        { "LOCK", true },
+        { "UNLOCK", true },
+        { "COPY", true },
+        { "MOVE", true },
+        { "MKCOL", true },
+        { "HEAD", false },
+        { "LINK", true },
+        { "UNLINK", true },
+        { "CONNECT", false }
+    };
+
+    const size_t HTTPMethodsCount = sizeof(HTTPMethods) / sizeof(HTTPMethods[0]);
+
+    /** Longest accepted status code, in digits */
+    const size_t MaxStatusCodeDigits = 9;
+}
+
+HTTPMethodType snowcrash::GetHTTPMethodType(const HTTPMethod& method)
+{
+    if (method.empty())
+        return UndefinedHTTPMethodType;
+
+    for (size_t i = 1; i < HTTPMethodsCount; ++i) {
+        if (method == HTTPMethods[i].name)
+            return static_cast<HTTPMethodType>(i);
+    }
+
+    return UndefinedHTTPMethodType;
+}
+
+HTTPStatusCode snowcrash::GetHTTPStatusCode(const std::string& name)
+{
+    HTTPStatusCode code = 0;
+
+    for (size_t i = 0; i < name.length() && name[i] >= '0' && name[i] <= '9'; ++i) {
+        if (i == MaxStatusCodeDigits)
+            return 0;
+
+        code = code * 10 + (name[i] - '0');
+    }
+
+    return code;
+}
+
 StatusCodeTraits snowcrash::GetStatusCodeTrait(HTTPStatusCode code)
 {
     StatusCodeTraits traits;
@@ -34,16 +101,24 @@ StatusCodeTraits snowcrash::GetStatusCodeTrait(HTTPStatusCode code)
     return traits;
 }
 
-HTTPMethodTraits snowcrash::GetMethodTrait(HTTPMethod method)
+HTTPMethodTraits snowcrash::GetMethodTrait(HTTPMethodType type)
 {
     HTTPMethodTraits traits;
-    traits.method = method;
 
-    // Following HTTP methods MUST NOT contain response body
-    // FIXME: When refactoring traits don't forget that 'CONNECT' has no body only when 1xx-2xx
-    if (method == HTTPMethodName::Head || method == HTTPMethodName::Connect) {
-        traits.allowBody = false;
-    }
+    if (static_cast<size_t>(type) >= HTTPMethodsCount)
+        return traits;
+
+    traits.method = HTTPMethods[type].name;
+    traits.type = type;
+    traits.allowBody = HTTPMethods[type].allowBody;
+
+    return traits;
+}
+
+HTTPMethodTraits snowcrash::GetMethodTrait(HTTPMethod method)
+{
+    HTTPMethodTraits traits = GetMethodTrait(GetHTTPMethodType(method));
+    traits.method = method;
 
     return traits;
 }
@@ -51,11 +51,6 @@ namespace snowcrash {
         static const std::string Connect;
     };
 
-    /**
-     *  A HTTP Status code.
-     */
-    typedef unsigned int HTTPStatusCode;
-
     /**
      *  Traits of a HTTP response.
      */
@@ -75,7 +70,8 @@ namespace snowcrash {
     struct HTTPMethodTraits : HTTPResponseTraits
     {
         HTTPMethod method;
-        HTTPMethodTraits() : method("") {}
+        HTTPMethodType type;
+        HTTPMethodTraits() : method(""), type(UndefinedHTTPMethodType) {}
     };
 
     /**
@@ -90,6 +86,20 @@ namespace snowcrash {
         StatusCodeTraits() : code(0) {}
     };
 
+    /**
+     *  \brief  Retrieve type of given HTTP method.
+     *  \param  method  HTTP method to retrieve type for.
+     *  \return A %HTTPMethodType for given method, `UndefinedHTTPMethodType` if not recognized.
+     */
+    extern HTTPMethodType GetHTTPMethodType(const HTTPMethod& method);
+
+    /**
+     *  \brief  Retrieve status code from a response name.
+     *  \param  name    Name of a response, e.g. "200".
+     *  \return A %HTTPStatusCode for given name, 0 if the name is not a status code.
+     */
+    extern HTTPStatusCode GetHTTPStatusCode(const std::string& name);
+
     /**
      *  \brief  Retrieve response traits for given HTTP method.
      *  \param  method  HTTP method to retrieve traits for.
@@ -97,6 +107,13 @@ namespace snowcrash {
      */
     extern HTTPMethodTraits GetMethodTrait(HTTPMethod method);
 
+    /**
+     *  \brief  Retrieve response traits for given HTTP method type.
+     *  \param  type    HTTP method type to retrieve traits for.
+     *  \return A %HTTPMethodTraits for given method type.
+     */
+    extern HTTPMethodTraits GetMethodTrait(HTTPMethodType type);
+
     /**
      *  \brief  Retrieve response traits for given status code.
      *  \param  code    A HTTP status code to retrieve traits for.
@@ -0,0 +1,185 @@
+//
+//  HeaderSignature.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <cstring>
+#include "HeaderSignature.h"
+#include "StringUtility.h"
+
+using namespace snowcrash;
+
+/** Recognized HTTP request methods, see HTTP_REQUEST_METHOD */
+static const char* const HTTPRequestMethods[] = {
+    "GET", "POST", "PUT", "DELETE", "OPTIONS", "PATCH", "PROPPATCH", "LOCK",
+    "UNLOCK", "COPY", "MOVE", "MKCOL", "HEAD", "LINK", "UNLINK", "CONNECT"
+};
+
+static inline bool IsBlank(char c)
+{
+    return c == ' ' || c == '\t';
+}
+
+/** \returns True for characters not allowed in a symbol identifier */
+static inline bool IsSymbolBracket(char c)
+{
+    return c == '[' || c == ']' || c == '(' || c == ')';
+}
+
+/** \returns Position of the first character after leading blanks */
+static size_t SkipBlanks(const mdp::ByteBuffer& s, size_t position)
+{
+    while (position < s.length() && IsBlank(s[position]))
+        ++position;
+
+    return position;
+}
+
+/** \returns Range of [begin, end) with white space trimmed */
+static mdp::BytesRange TrimmedRange(const mdp::ByteBuffer& s, size_t begin, size_t end)
+{
+    while (begin < end && isSpace(s[begin]))
+        ++begin;
+
+    while (end > begin && isSpace(s[end - 1]))
+        --end;
+
+    return mdp::BytesRange(begin, end - begin);
+}
+
+/** \returns Length of the HTTP request method at position, 0 if none */
+static size_t HTTPRequestMethodAt(const mdp::ByteBuffer& s, size_t position)
+{
+    for (size_t i = 0; i < sizeof(HTTPRequestMethods) / sizeof(HTTPRequestMethods[0]); ++i) {
+
+        size_t length = ::strlen(HTTPRequestMethods[i]);
+
+        if (s.compare(position, length, HTTPRequestMethods[i]) == 0)
+            return length;
+    }
+
+    return 0;
+}
+
+/** \returns Position of the first symbol bracket, end of text if none */
+static size_t FindSymbolBracket(const mdp::ByteBuffer& s, size_t position)
+{
+    while (position < s.length() && !IsSymbolBracket(s[position]))
+        ++position;
+
+    return position;
+}
+
+/** Scan `<keyword> <name>` with case-insensitive first letter of the keyword */
+static bool ScanKeywordHeader(const mdp::ByteBuffer& s, const char* keyword, HeaderSignature& signature)
+{
+    size_t position = SkipBlanks(s, 0);
+    size_t length = ::strlen(keyword);
+
+    if (position + length > s.length() ||
+        (s[position] != keyword[0] && s[position] != keyword[0] - 'a' + 'A') ||
+        s.compare(position + 1, length - 1, keyword + 1) != 0)
+        return false;
+
+    position += length;
+
+    // At least one blank and one character of name
+    if (position + 2 > s.length() || !IsBlank(s[position]))
+        return false;
+
+    if (FindSymbolBracket(s, position) != s.length())
+        return false;
+
+    signature.name = TrimmedRange(s, position, s.length());
+    return true;
+}
+
+bool snowcrash::ScanResourceHeader(const mdp::ByteBuffer& text, HeaderSignature& signature)
+{
+    size_t position = SkipBlanks(text, 0);
+    size_t method = HTTPRequestMethodAt(text, position);
+
+    if (method != 0) {
+
+        size_t uri = SkipBlanks(text, position + method);
+
+        if (uri > position + method && uri < text.length() && text[uri] == '/') {
+            signature.method = mdp::BytesRange(position, method);
+            signature.uriTemplate = mdp::BytesRange(uri, text.length() - uri);
+            return true;
+        }
+    }
+
+    if (position < text.length() && text[position] == '/') {
+        signature.uriTemplate = mdp::BytesRange(position, text.length() - position);
+        return true;
+    }
+
+    return false;
+}
+
+bool snowcrash::ScanNamedResourceHeader(const mdp::ByteBuffer& text, HeaderSignature& signature)
+{
+    size_t open = FindSymbolBracket(text, 0);
+
+    // Name and blanks before `[/`, `]` closing the text
+    if (open < 2 ||
+        open + 2 >= text.length() ||
+        text[open] != '[' ||
+        !IsBlank(text[open - 1]) ||
+        text[open + 1] != '/' ||
+        text[text.length() - 1] != ']')
+        return false;
+
+    signature.name = TrimmedRange(text, 0, open);
+    signature.uriTemplate = mdp::BytesRange(open + 1, text.length() - open - 2);
+    return true;
+}
+
+bool snowcrash::ScanActionHeader(const mdp::ByteBuffer& text, HeaderSignature& signature)
+{
+    size_t position = SkipBlanks(text, 0);
+    size_t method = HTTPRequestMethodAt(text, position);
+
+    if (method == 0)
+        return false;
+
+    size_t uri = SkipBlanks(text, position + method);
+
+    if (uri < text.length() && text[uri] != '/')
+        return false;
+
+    signature.method = mdp::BytesRange(position, method);
+    signature.uriTemplate = mdp::BytesRange(uri, text.length() - uri);
+    return true;
+}
+
+bool snowcrash::ScanNamedActionHeader(const mdp::ByteBuffer& text, HeaderSignature& signature)
+{
+    size_t open = FindSymbolBracket(text, 0);
+
+    if (open < 1 || open >= text.length() || text[open] != '[')
+        return false;
+
+    size_t method = HTTPRequestMethodAt(text, open + 1);
+
+    if (method == 0 || open + method + 2 != text.length() || text[open + method + 1] != ']')
+        return false;
+
+    signature.name = TrimmedRange(text, 0, open);
+    signature.method = mdp::BytesRange(open + 1, method);
+    return true;
+}
+
+bool snowcrash::ScanGroupHeader(const mdp::ByteBuffer& text, HeaderSignature& signature)
+{
+    return ScanKeywordHeader(text, "group", signature);
+}
+
+bool snowcrash::ScanDataStructureHeader(const mdp::ByteBuffer& text, HeaderSignature& signature)
+{
+    return ScanKeywordHeader(text, "structure", signature);
+}
@@ -0,0 +1,76 @@
+//
+//  HeaderSignature.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_HEADERSIGNATURE_H
+#define SNOWCRASH_HEADERSIGNATURE_H
+
+#include "ByteBuffer.h"
+
+namespace snowcrash {
+
+    /**
+     *  \brief Parts of a Markdown header signature
+     *
+     *  Ranges point into the scanned text, a missing part has zero length.
+     *  Names are trimmed.
+     */
+    struct HeaderSignature {
+
+        /** HTTP request method */
+        mdp::BytesRange method;
+
+        /** Name of a resource, action, group or data structure */
+        mdp::BytesRange name;
+
+        /** URI template */
+        mdp::BytesRange uriTemplate;
+
+        /** \returns Text of a part */
+        static mdp::ByteBuffer part(const mdp::ByteBuffer& text, const mdp::BytesRange& range) {
+            return text.substr(range.location, range.length);
+        }
+    };
+
+    /**
+     *  \brief Scan nameless resource header `[<HTTP method>] <URI template>`
+     *  \return True if the text is a nameless resource header
+     */
+    bool ScanResourceHeader(const mdp::ByteBuffer& text, HeaderSignature& signature);
+
+    /**
+     *  \brief Scan named resource header `<name> [<URI template>]`
+     *  \return True if the text is a named resource header
+     */
+    bool ScanNamedResourceHeader(const mdp::ByteBuffer& text, HeaderSignature& signature);
+
+    /**
+     *  \brief Scan action header `<HTTP method> [<URI template>]`
+     *  \return True if the text is an action header
+     */
+    bool ScanActionHeader(const mdp::ByteBuffer& text, HeaderSignature& signature);
+
+    /**
+     *  \brief Scan named action header `<name> [<HTTP method>]`
+     *  \return True if the text is a named action header
+     */
+    bool ScanNamedActionHeader(const mdp::ByteBuffer& text, HeaderSignature& signature);
+
+    /**
+     *  \brief Scan resource group header `group <name>`
+     *  \return True if the text is a resource group header
+     */
+    bool ScanGroupHeader(const mdp::ByteBuffer& text, HeaderSignature& signature);
+
+    /**
+     *  \brief Scan data structure header `structure <name>`
+     *  \return True if the text is a data structure header
+     */
+    bool ScanDataStructureHeader(const mdp::ByteBuffer& text, HeaderSignature& signature);
+}
+
+#endif
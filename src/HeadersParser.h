@@ -17,17 +17,14 @@
 
 namespace snowcrash {
 
-    /** Headers matching regex */
-    const char* const HeadersRegex = "^[[:blank:]]*[Hh]eaders?[[:blank:]]*$";
-
     /** Header Iterator in its containment group */
     typedef Collection<Header>::const_iterator HeaderIterator;
 
     /**
      *  Headers Section Processor
      */
-    template<>
-    struct SectionProcessor<Headers> : public SectionProcessorBase<Headers> {
+    template<typename SourceMapPolicy>
+    struct SectionProcessor<Headers, SourceMapPolicy> : public SectionProcessorBase<Headers, SourceMapPolicy> {
 
         static MarkdownNodeIterator processSignature(const MarkdownNodeIterator& node,
                                                      const MarkdownNodes& siblings,
@@ -36,7 +33,7 @@ namespace snowcrash {
                                                      const ParseResultRef<Headers>& out) {
 
             mdp::ByteBuffer content;
-            CodeBlockUtility::signatureContentAsCodeBlock(node, pd, out.report, content);
+            CodeBlockUtility::signatureContentAsCodeBlock(node, pd, out.report, &content);
 
             headersFromContent(node, content, pd, out);
 
@@ -57,7 +54,7 @@ namespace snowcrash {
                                                    const ParseResultRef<Headers>& out) {
 
             mdp::ByteBuffer content;
-            CodeBlockUtility::contentAsCodeBlock(node, pd, out.report, content);
+            CodeBlockUtility::contentAsCodeBlock(node, pd, out.report, &content);
 
             headersFromContent(node, content, pd, out);
 
@@ -80,14 +77,10 @@ namespace snowcrash {
             if (node->type == mdp::ListItemMarkdownNodeType
                 && !node->children().empty()) {
 
-                mdp::ByteBuffer subject = node->children().front().text;
-                mdp::ByteBuffer signature;
-                mdp::ByteBuffer remainingContent;
-
-                signature = GetFirstLine(subject, remainingContent);
-                TrimString(signature);
+                StringView remainingContent;
+                StringView signature = FirstLineView(StringView(node->children().front().text), remainingContent);
 
-                if (RegexMatch(signature, HeadersRegex))
+                if (MatchSectionKeyword(TrimView(signature), "Header", true))
                     return HeadersSectionType;
             }
 
@@ -114,19 +107,18 @@ namespace snowcrash {
                                        SectionParserData& pd,
                                        const ParseResultRef<Headers>& out) {
 
-            std::vector<std::string> lines = Split(content, '\n');
+            LineIterator lines((StringView(content)));
+            StringView line;
 
-            for (std::vector<std::string>::iterator line = lines.begin();
-                 line != lines.end();
-                 ++line) {
+            while (lines.next(line)) {
 
-                if (TrimString(*line).empty()) {
+                if (TrimView(line).empty()) {
                     continue;
                 }
 
                 Header header;
 
-                if (CodeBlockUtility::keyValueFromLine(*line, header)) {
+                if (CodeBlockUtility::keyValueFromLine(line, header)) {
                     if (findHeader(out.node, header) != out.node.end() && !isAllowedMultipleDefinition(header)) {
                         // WARN: duplicate header on this level
                         std::stringstream ss;
@@ -141,7 +133,7 @@ namespace snowcrash {
 
                     out.node.push_back(header);
 
-                    if (pd.exportSourceMap()) {
+                    if (SourceMapPolicy::exportSourceMap(pd)) {
                         SourceMap<Header> headerSM;
                         headerSM.sourceMap = node->sourceMap;
                         out.sourceMap.collection.push_back(headerSM);
@@ -166,7 +158,7 @@ namespace snowcrash {
             Collection<TransactionExample>::iterator exampleIt = examples.begin();
             Collection<SourceMap<TransactionExample> >::iterator exampleSourceMapIt;
 
-            if (pd.exportSourceMap()) {
+            if (SourceMapPolicy::exportSourceMap(pd)) {
                 exampleSourceMapIt = examplesSM.collection.begin();
             }
 
@@ -175,7 +167,7 @@ namespace snowcrash {
                 Collection<Request>::iterator requestIt = exampleIt->requests.begin();
                 Collection<SourceMap<Request> >::iterator requestSourceMapIt;
 
-                if (pd.exportSourceMap()) {
+                if (SourceMapPolicy::exportSourceMap(pd)) {
                     requestSourceMapIt = exampleSourceMapIt->requests.collection.begin();
                 }
 
@@ -185,7 +177,7 @@ namespace snowcrash {
                      requestIt->headers.insert(requestIt->headers.begin(), headers.begin(), headers.end());
                      ++requestIt;
 
-                     if (pd.exportSourceMap()) {
+                     if (SourceMapPolicy::exportSourceMap(pd)) {
                          requestSourceMapIt->headers.collection.insert(requestSourceMapIt->headers.collection.begin(),
                                                                        headersSM.collection.begin(),
                                                                        headersSM.collection.end());
@@ -196,7 +188,7 @@ namespace snowcrash {
                 Collection<Response>::iterator responseIt = exampleIt->responses.begin();
                 Collection<SourceMap<Response> >::iterator responseSourceMapIt;
 
-                if (pd.exportSourceMap()) {
+                if (SourceMapPolicy::exportSourceMap(pd)) {
                     responseSourceMapIt = exampleSourceMapIt->responses.collection.begin();
                 }
 
@@ -206,7 +198,7 @@ namespace snowcrash {
                     responseIt->headers.insert(responseIt->headers.begin(), headers.begin(), headers.end());
                     ++responseIt;
 
-                    if (pd.exportSourceMap()) {
+                    if (SourceMapPolicy::exportSourceMap(pd)) {
                         responseSourceMapIt->headers.collection.insert(responseSourceMapIt->headers.collection.begin(),
                                                                        headersSM.collection.begin(),
                                                                        headersSM.collection.end());
@@ -216,7 +208,7 @@ namespace snowcrash {
 
                 ++exampleIt;
 
-                if (pd.exportSourceMap()) {
+                if (SourceMapPolicy::exportSourceMap(pd)) {
                     ++exampleSourceMapIt;
                 }
             }
@@ -231,24 +223,16 @@ namespace snowcrash {
                                 std::bind2nd(MatchFirsts<Header, IEqual<Header::first_type> >(), header));
         }
 
-        typedef std::vector<std::string> HeadersKeyCollection;
-        /** Get collection of allowed keywords - workarround due to C++98 restriction - static initialization of vector */
-        static const HeadersKeyCollection& getAllowedMultipleDefinitions() {
-            static std::string keys[] = {
-                HTTPHeaderName::SetCookie,
-                HTTPHeaderName::Link,
-            };
-
-            static const HeadersKeyCollection allowedMultipleDefinitions(keys, keys + (sizeof(keys)/sizeof(keys[0])));
-            return allowedMultipleDefinitions;
-        }
-
-        /** Check if Header name has allowed multiple definitions */
+        /**
+         *  \brief Check if Header name has allowed multiple definitions
+         *
+         *  Avoids function-local statics, their initialization isn't
+         *  thread-safe on every supported toolchain.
+         */
         static bool isAllowedMultipleDefinition(const Header& header) {
-              const HeadersKeyCollection& keys = getAllowedMultipleDefinitions();
-              return std::find_if(keys.begin(),
-                                  keys.end(),
-                                  std::bind1st(MatchFirstWith<Header, std::string, IEqual<std::string> >(), header)) != keys.end();
+            IEqual<std::string> equal;
+            return equal(header.first, HTTPHeaderName::SetCookie) ||
+                   equal(header.first, HTTPHeaderName::Link);
         }
     };
 
@@ -0,0 +1,26 @@
+//
+//  ParallelFor.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_PARALLELFOR_H
+#define SNOWCRASH_PARALLELFOR_H
+
+#include <cstddef>
+
+namespace snowcrash {
+
+    // Task run for one index, context is passed through from ParallelFor
+    typedef void (*ParallelTask)(size_t index, void* context);
+
+    // Run task for every index in [0, count) on up to `threads` threads,
+    // the indices are handed out in order to the first idle thread.
+    // Returns when every task is done. Runs the tasks on the calling
+    // thread if `threads` is 1 or less or no thread could be started.
+    void ParallelFor(size_t count, size_t threads, ParallelTask task, void* context);
+}
+
+#endif
@@ -11,44 +11,12 @@
 
 #include "SectionParser.h"
 #include "ValuesParser.h"
+#include "ParameterSignature.h"
 #include "RegexMatch.h"
 #include "StringUtility.h"
 
-/** Parameter Value regex */
-#define PARAMETER_VALUE "`([^`]+)`"
-
-/** Parameter Identifier */
-#define PARAMETER_IDENTIFIER "(([\\w.-\\[\\]])*|(%[A-Fa-f0-9]{2})*)+"
-
-/** Lead in and out for comma separated values regex */
-#define CSV_LEADINOUT "[[:blank:]]*,?[[:blank:]]*"
-
 namespace snowcrash {
 
-    /** Parameter Required matching regex */
-    const char* const ParameterRequiredRegex = "^[[:blank:]]*[Rr]equired[[:blank:]]*$";
-
-    /** Parameter Optional matching regex */
-    const char* const ParameterOptionalRegex = "^[[:blank:]]*[Oo]ptional[[:blank:]]*$";
-
-    /** Parameter Read-Only matching regex */
-    const char* const ParameterReadOnlyRegex = "^[[:blank:]]*[Rr]eadonly[[:blank:]]*$";
-
-    /** Parameter Write-Only matching regex */
-    const char* const ParameterWriteOnlyRegex = "^[[:blank:]]*[Ww]riteonly[[:blank:]]*$";
-
-    /** Additonal Parameter Traits Example matching regex */
-    const char* const AdditionalTraitsExampleRegex = CSV_LEADINOUT "`([^`]*)`" CSV_LEADINOUT;
-
-    /** Additonal Parameter Traits Use matching regex */
-    const char* const AdditionalTraitsUseRegex = CSV_LEADINOUT "([Oo]ptional|[Rr]equired|[Rr]eadonly|[Ww]riteonly)" CSV_LEADINOUT;
-
-    /** Additonal Parameter Traits Type matching regex */
-    const char* const AdditionalTraitsTypeRegex = CSV_LEADINOUT "([^,]*)" CSV_LEADINOUT;
-
-    /** Parameter Values matching regex */
-    const char* const ParameterValuesRegex = "^[[:blank:]]*[Vv]alues[[:blank:]]*$";
-
     /** Values expected content */
     const char* const ExpectedValuesContent = "nested list of possible parameter values, one element per list item e.g. '`value`'";
 
@@ -58,8 +26,8 @@ namespace snowcrash {
     /**
      * Parameter section processor
      */
-    template<>
-    struct SectionProcessor<Parameter> : public SectionProcessorBase<Parameter> {
+    template<typename SourceMapPolicy>
+    struct SectionProcessor<Parameter, SourceMapPolicy> : public SectionProcessorBase<Parameter, SourceMapPolicy> {
 
         static MarkdownNodeIterator processSignature(const MarkdownNodeIterator& node,
                                                      const MarkdownNodes& siblings,
@@ -73,9 +41,11 @@ namespace snowcrash {
             parseSignature(node, pd, signature, out);
 
             if (!remainingContent.empty()) {
-                out.node.description += "\n" + remainingContent + "\n";
 
-                if (pd.exportSourceMap()) {
+                if (!pd.skip(SkipDescriptionsOption))
+                    out.node.description += "\n" + remainingContent + "\n";
+
+                if (SourceMapPolicy::exportSourceMap(pd) || pd.skip(SkipDescriptionsOption)) {
                     out.sourceMap.description.sourceMap.append(node->sourceMap);
                 }
             }
@@ -109,12 +79,12 @@ namespace snowcrash {
             // Clear any previous values
             out.node.values.clear();
 
-            if (pd.exportSourceMap()) {
+            if (SourceMapPolicy::exportSourceMap(pd)) {
                 out.sourceMap.values.collection.clear();
             }
 
             ParseResultRef<Values> values(out.report, out.node.values, out.sourceMap.values);
-            ValuesParser::parse(node, siblings, pd, values);
+            SectionParser<Values, ListSectionAdapter, SourceMapPolicy>::parse(node, siblings, pd, values);
 
             if (out.node.values.empty()) {
                 // WARN: empty definition
@@ -136,16 +106,23 @@ namespace snowcrash {
             return ++MarkdownNodeIterator(node);
         }
 
+        static void finalize(const MarkdownNodeIterator& node,
+                             SectionParserData& pd,
+                             const ParseResultRef<Parameter>& out) {
+
+            if (pd.events)
+                pd.events->parameter(out.node);
+        }
+
         static SectionType sectionType(const MarkdownNodeIterator& node) {
 
             if (node->type == mdp::ListItemMarkdownNodeType
                 && !node->children().empty()) {
 
-                mdp::ByteBuffer subject, remainingContent;
-                subject = GetFirstLine(node->children().front().text, remainingContent);
-                TrimString(subject);
+                StringView remainingContent;
+                StringView subject = TrimView(FirstLineView(StringView(node->children().front().text), remainingContent));
 
-                if (isValidParameterSignature(subject)) {
+                if (IsValidParameterSignature(subject.str())) {
                     return ParameterSectionType;
                 }
             }
@@ -155,7 +132,7 @@ namespace snowcrash {
 
         static SectionType nestedSectionType(const MarkdownNodeIterator& node) {
 
-            return SectionProcessor<Values>::sectionType(node);
+            return SectionProcessor<Values, SourceMapPolicy>::sectionType(node);
         }
 
         static SectionTypes nestedSectionTypes() {
@@ -171,66 +148,17 @@ namespace snowcrash {
                                    mdp::ByteBuffer& signature,
                                    const ParseResultRef<Parameter>& out) {
 
-            out.node.use = UndefinedParameterUse;
-
-            TrimString(signature);
+            ParameterSignatureComponents components;
 
-            CaptureGroups captureGroups;
+            if (ParseParameterSignature(signature, out.node, components)) {
 
-            if (isValidParameterSignature(signature)) {
-
-                mdp::ByteBuffer innerSignature = signature;
-                innerSignature = TrimString(innerSignature);
-
-                size_t firstSpace = innerSignature.find(" ");
-
-                if (firstSpace == std::string::npos) {
-                    // Name
-                    out.node.name = signature;
+                // The description is a part of the signature line, drop it as soon as it is split off
+                if (pd.skip(SkipDescriptionsOption) && !out.node.description.empty()) {
+                    out.sourceMap.description.sourceMap = node->sourceMap;
+                    out.node.description.clear();
                 }
-                else {
-                    out.node.name = innerSignature.substr(0, firstSpace);
-                    innerSignature = innerSignature.substr(firstSpace + 1);
-
-                    size_t descriptionPos = innerSignature.find(snowcrash::DescriptionIdentifier);
-
-                    if (descriptionPos != std::string::npos) {
-                        // Description
-                        out.node.description = innerSignature.substr(descriptionPos);
-                        out.node.description = TrimString(out.node.description.replace(0, snowcrash::DescriptionIdentifier.length(), ""));
-
-                        innerSignature = innerSignature.substr(0, descriptionPos);
-                        innerSignature = TrimString(innerSignature);
-                    }
-
-                    size_t attributesPos = innerSignature.find("(");
-
-                    if (attributesPos != std::string::npos) {
-                        size_t endOfAttributesPos = innerSignature.find_last_of(")");
-
-                        if (endOfAttributesPos - attributesPos > 1) {
-                            std::string attributes = innerSignature.substr(attributesPos, endOfAttributesPos - attributesPos);
-                            attributes = attributes.substr(1);
-
-                            parseAdditionalTraits(node, pd, attributes, out);
-
-                            innerSignature = innerSignature.substr(0, attributesPos);
-                            innerSignature = TrimString(innerSignature);
-                        }
-                    }
-
-                    if (innerSignature.length() > 0) {
-                        // Remove =
-                        out.node.defaultValue = innerSignature;
-
-                        out.node.defaultValue.erase(std::remove(out.node.defaultValue.begin(), out.node.defaultValue.end(), '='), out.node.defaultValue.end());
-                        out.node.defaultValue.erase(std::remove(out.node.defaultValue.begin(), out.node.defaultValue.end(), '`'), out.node.defaultValue.end());
 
-                        out.node.defaultValue = TrimString(out.node.defaultValue);
-                    }
-                }
-
-                if (pd.exportSourceMap()) {
+                if (SourceMapPolicy::exportSourceMap(pd)) {
                     if (!out.node.name.empty()) {
                         out.sourceMap.name.sourceMap = node->sourceMap;
                     }
@@ -242,6 +170,31 @@ namespace snowcrash {
                     if (!out.node.defaultValue.empty()) {
                         out.sourceMap.defaultValue.sourceMap = node->sourceMap;
                     }
+
+                    if (components & ExampleValueParameterComponent) {
+                        out.sourceMap.exampleValue.sourceMap = node->sourceMap;
+                    }
+
+                    if (components & UseParameterComponent) {
+                        out.sourceMap.use.sourceMap = node->sourceMap;
+                    }
+
+                    if (components & TypeParameterComponent) {
+                        out.sourceMap.type.sourceMap = node->sourceMap;
+                    }
+                }
+
+                if (components & InvalidTraitsParameterComponent) {
+                    // WARN: Additional parameters traits warning
+                    std::stringstream ss;
+                    ss << "unable to parse additional parameter traits";
+                    ss << ", expected '([required | optional | readonly | writeonly], [<type>], [`<example value>`])'";
+                    ss << ", e.g. '(optional, string, `Hello World`)'";
+
+                    mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
+                    out.report.warnings.push_back(Warning(ss.str(),
+                                                          FormattingWarning,
+                                                          sourceMap));
                 }
 
                 // Check possible required vs default clash
@@ -269,110 +222,6 @@ namespace snowcrash {
             }
         }
 
-        static ParameterUse parseParameterUse(const std::string& target) {
-            if (RegexMatch(target, ParameterOptionalRegex)) {
-                return OptionalParameterUse;
-            }
-
-            if (RegexMatch(target, ParameterReadOnlyRegex)) {
-                return ReadOnlyParameterUse;
-            }
-
-            if (RegexMatch(target, ParameterWriteOnlyRegex)) {
-                return WriteOnlyParameterUse;
-            } 
-
-            return RequiredParameterUse;
-        }
-
-        static void parseAdditionalTraits(const mdp::MarkdownNodeIterator& node,
-                                          SectionParserData& pd,
-                                          mdp::ByteBuffer& traits,
-                                          const ParseResultRef<Parameter>& out) {
-
-            TrimString(traits);
-
-            CaptureGroups captureGroups;
-
-            // Cherry pick example value, if any
-            if (RegexCapture(traits, AdditionalTraitsExampleRegex, captureGroups) &&
-                captureGroups.size() > 1) {
-
-                out.node.exampleValue = captureGroups[1];
-                std::string::size_type pos = traits.find(captureGroups[0]);
-
-                if (pos != std::string::npos) {
-                    traits.replace(pos, captureGroups[0].length(), std::string());
-                }
-
-                if (pd.exportSourceMap()) {
-                    out.sourceMap.exampleValue.sourceMap = node->sourceMap;
-                }
-             }
-
-            captureGroups.clear();
-
-            // Cherry pick use attribute, if any
-            if (RegexCapture(traits, AdditionalTraitsUseRegex, captureGroups) &&
-                captureGroups.size() > 1) {
-
-                out.node.use = parseParameterUse(captureGroups[1]);
-                std::string::size_type pos = traits.find(captureGroups[0]);
-
-                if (pos != std::string::npos) {
-                    traits.replace(pos, captureGroups[0].length(), std::string());
-                }
-
-                if (pd.exportSourceMap()) {
-                    out.sourceMap.use.sourceMap = node->sourceMap;
-                }
-            }
-
-            captureGroups.clear();
-
-            // Finish with type
-            if (RegexCapture(traits, AdditionalTraitsTypeRegex, captureGroups) &&
-                captureGroups.size() > 1) {
-
-                out.node.type = captureGroups[1];
-                std::string::size_type pos = traits.find(captureGroups[0]);
-
-                if (pos != std::string::npos) {
-                    traits.replace(pos, captureGroups[0].length(), std::string());
-                }
-
-                if (pd.exportSourceMap()) {
-                    out.sourceMap.type.sourceMap = node->sourceMap;
-                }
-            }
-
-            // Check what is left
-            TrimString(traits);
-
-            if (!traits.empty()) {
-                // WARN: Additional parameters traits warning
-                std::stringstream ss;
-                ss << "unable to parse additional parameter traits";
-                ss << ", expected '([required | optional | readonly | writeonly], [<type>], [`<example value>`])'";
-                ss << ", e.g. '(optional, string, `Hello World`)'";
-
-                mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
-                out.report.warnings.push_back(Warning(ss.str(),
-                                                      FormattingWarning,
-                                                      sourceMap));
-
-                out.node.type.clear();
-                out.node.exampleValue.clear();
-                out.node.use = UndefinedParameterUse;
-
-                if (pd.exportSourceMap()) {
-                    out.sourceMap.type.sourceMap.clear();
-                    out.sourceMap.exampleValue.sourceMap.clear();
-                    out.sourceMap.use.sourceMap.clear();
-                }
-            }
-        }
-
         static void checkExampleAndDefaultValue(const mdp::MarkdownNodeIterator& node,
                                                 SectionParserData& pd,
                                                 const ParseResultRef<Parameter>& out) {
@@ -419,73 +268,6 @@ namespace snowcrash {
                                                       sourceMap));
             }
         }
-
-        /** Determine if a signature is a valid parameter*/
-        static bool isValidParameterSignature(const mdp::ByteBuffer& signature) {
-
-            mdp::ByteBuffer innerSignature = signature;
-            innerSignature = TrimString(innerSignature);
-
-            if (innerSignature.length() == 0) {
-                return false; // Empty string, invalid
-            }
-
-            size_t firstSpace = innerSignature.find(" ");
-
-            if (firstSpace == std::string::npos) {
-                return RegexMatch(innerSignature, "^" PARAMETER_IDENTIFIER "$");
-            }
-
-            std::string paramName = innerSignature.substr(0, firstSpace);
-
-            if (!RegexMatch(paramName, PARAMETER_IDENTIFIER)) {
-                return false; // Invalid param name
-            }
-
-            // Remove param name
-            innerSignature = innerSignature.substr(firstSpace + 1);
-            size_t descriptionPos = innerSignature.find(snowcrash::DescriptionIdentifier);
-
-            // Remove description
-            if (descriptionPos != std::string::npos) {
-                innerSignature = innerSignature.substr(0, descriptionPos);
-                innerSignature = TrimString(innerSignature);
-            }
-
-            size_t attributesPos = innerSignature.find("(");
-
-            if (attributesPos != std::string::npos) {
-                size_t endOfAttributesPos = innerSignature.find_last_of(")");
-
-                if (endOfAttributesPos == std::string::npos) {
-                    return false; // Expecting close of attributes
-                }
-
-                // Remove attributes
-                innerSignature = innerSignature.substr(0, attributesPos);
-                innerSignature = TrimString(innerSignature);
-            }
-
-            if (innerSignature.length() == 0) {
-                return true;
-            }
-
-            if (innerSignature.substr(0,1) == "=") {
-                innerSignature = innerSignature.substr(1);
-                innerSignature = TrimString(innerSignature);
-
-                if (innerSignature.length() == 0) {
-                    return false; // No default value
-                }
-
-                if (innerSignature.substr(0,1) == "`" && innerSignature.substr(innerSignature.length()-1,1) == "`") {
-                    return true;
-                }
-            }
-
-            return false;
-        }
-
     };
 
     /** Parameter Section Parser */
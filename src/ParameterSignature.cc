@@ -0,0 +1,418 @@
+//
+//  ParameterSignature.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <cstring>
+#include "ParameterSignature.h"
+#include "StringUtility.h"
+
+using namespace snowcrash;
+
+/** Parameter description delimiter */
+static const char DescriptionDelimiter[] = "...";
+
+/** Half-open range of characters in a string */
+struct TextSpan {
+
+    TextSpan(size_t begin_, size_t end_) : begin(begin_), end(end_) {}
+
+    size_t begin;
+    size_t end;
+
+    bool empty() const {
+        return begin >= end;
+    }
+};
+
+/** Parameter use keywords, the first letter is case-insensitive */
+struct ParameterUseKeyword {
+    const char* keyword;
+    ParameterUse use;
+};
+
+static const ParameterUseKeyword ParameterUseKeywords[] = {
+    { "optional", OptionalParameterUse },
+    { "required", RequiredParameterUse },
+    { "readonly", ReadOnlyParameterUse },
+    { "writeonly", WriteOnlyParameterUse }
+};
+
+static inline bool IsBlank(char c)
+{
+    return c == ' ' || c == '\t';
+}
+
+static inline bool IsHexDigit(char c)
+{
+    return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'F') || (c >= 'a' && c <= 'f');
+}
+
+static inline bool IsIdentifierCharacter(char c)
+{
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') ||
+           c == '_' || c == '.' || c == '-' || c == '[' || c == ']';
+}
+
+/** Shrink a span to exclude leading and trailing white space */
+static TextSpan Trim(const std::string& s, TextSpan span)
+{
+    while (span.begin < span.end && isSpace(s[span.begin]))
+        ++span.begin;
+
+    while (span.end > span.begin && isSpace(s[span.end - 1]))
+        --span.end;
+
+    return span;
+}
+
+/** \returns Position of the first `c` in the span, `span.end` if none */
+static size_t Find(const std::string& s, TextSpan span, char c)
+{
+    for (size_t i = span.begin; i < span.end; ++i) {
+        if (s[i] == c)
+            return i;
+    }
+
+    return span.end;
+}
+
+/** \returns Position of the first description delimiter in the span, `span.end` if none */
+static size_t FindDescription(const std::string& s, TextSpan span)
+{
+    size_t length = sizeof(DescriptionDelimiter) - 1;
+
+    for (size_t i = span.begin; i + length <= span.end; ++i) {
+        if (s.compare(i, length, DescriptionDelimiter) == 0)
+            return i;
+    }
+
+    return span.end;
+}
+
+/** \returns True if the span is a parameter name of word characters and percent-encoded characters */
+static bool IsParameterIdentifier(const std::string& s, TextSpan span)
+{
+    if (span.empty())
+        return false;
+
+    for (size_t i = span.begin; i < span.end; ++i) {
+
+        if (IsIdentifierCharacter(s[i]))
+            continue;
+
+        if (s[i] == '%' && i + 2 < span.end && IsHexDigit(s[i + 1]) && IsHexDigit(s[i + 2])) {
+            i += 2;
+            continue;
+        }
+
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ *  \brief Parameter signature split into its parts
+ *
+ *  `inner` is what is left after the name, description and traits
+ *  have been cut off. It is trimmed only if something was cut off.
+ */
+struct SignatureParts {
+
+    SignatureParts()
+    : name(0, 0), description(0, 0), traits(0, 0), inner(0, 0), validatedInner(0, 0),
+      hasRest(false), hasDescription(false), hasTraitsBracket(false), hasTraits(false) {}
+
+    TextSpan name;
+    TextSpan description;
+    TextSpan traits;
+    TextSpan inner;
+
+    /** Inner part with traits cut off even if they are not parsed */
+    TextSpan validatedInner;
+
+    bool hasRest;           /// < Anything follows the name
+    bool hasDescription;    /// < Description delimiter found
+    bool hasTraitsBracket;  /// < Opening bracket of traits found
+    bool hasTraits;         /// < Traits are to be parsed
+};
+
+/** \returns False if the signature is not closing its traits */
+static bool SplitSignature(const std::string& s, SignatureParts& parts)
+{
+    TextSpan signature = Trim(s, TextSpan(0, s.length()));
+    size_t space = Find(s, signature, ' ');
+
+    parts.name = TextSpan(signature.begin, space);
+    parts.validatedInner = TextSpan(space, space);
+
+    if (space == signature.end)
+        return true;
+
+    parts.hasRest = true;
+    TextSpan inner(space + 1, signature.end);
+
+    size_t description = FindDescription(s, inner);
+
+    if (description != inner.end) {
+        parts.hasDescription = true;
+        parts.description = Trim(s, TextSpan(description + sizeof(DescriptionDelimiter) - 1, inner.end));
+        inner = Trim(s, TextSpan(inner.begin, description));
+    }
+
+    parts.inner = inner;
+    parts.validatedInner = inner;
+
+    size_t open = Find(s, inner, '(');
+
+    if (open == inner.end)
+        return true;
+
+    parts.hasTraitsBracket = true;
+
+    size_t close = std::string::npos;
+
+    for (size_t i = inner.end; i > inner.begin; --i) {
+        if (s[i - 1] == ')') {
+            close = i - 1;
+            break;
+        }
+    }
+
+    if (close == std::string::npos)
+        return false;
+
+    parts.validatedInner = Trim(s, TextSpan(inner.begin, open));
+
+    // Empty traits `()` stay a part of the inner signature
+    if (close != open + 1) {
+        parts.hasTraits = true;
+        parts.traits = TextSpan(open + 1, (close > open) ? close : inner.end);
+        parts.inner = parts.validatedInner;
+    }
+
+    return true;
+}
+
+bool snowcrash::IsValidParameterSignature(const mdp::ByteBuffer& signature)
+{
+    SignatureParts parts;
+
+    if (!SplitSignature(signature, parts))
+        return false;
+
+    if (parts.name.empty())
+        return false;
+
+    if (!parts.hasRest)
+        return IsParameterIdentifier(signature, parts.name);
+
+    TextSpan inner = parts.validatedInner;
+
+    if (inner.empty())
+        return true;
+
+    if (signature[inner.begin] != '=')
+        return false;
+
+    TextSpan value = Trim(signature, TextSpan(inner.begin + 1, inner.end));
+
+    if (value.empty())
+        return false;
+
+    return signature[value.begin] == '`' && signature[value.end - 1] == '`';
+}
+
+/** \returns Start of a `[[:blank:]]*,?[[:blank:]]*` run ending at position */
+static size_t LeadInStart(const std::string& s, size_t position)
+{
+    while (position > 0 && IsBlank(s[position - 1]))
+        --position;
+
+    if (position > 0 && s[position - 1] == ',') {
+        --position;
+
+        while (position > 0 && IsBlank(s[position - 1]))
+            --position;
+    }
+
+    return position;
+}
+
+/** \returns End of a `[[:blank:]]*,?[[:blank:]]*` run starting at position */
+static size_t LeadOutEnd(const std::string& s, size_t position)
+{
+    while (position < s.length() && IsBlank(s[position]))
+        ++position;
+
+    if (position < s.length() && s[position] == ',') {
+        ++position;
+
+        while (position < s.length() && IsBlank(s[position]))
+            ++position;
+    }
+
+    return position;
+}
+
+/** \returns Keyword of a parameter use at position, NULL if none */
+static const ParameterUseKeyword* ParameterUseKeywordAt(const std::string& s, size_t position)
+{
+    for (size_t i = 0; i < sizeof(ParameterUseKeywords) / sizeof(ParameterUseKeywords[0]); ++i) {
+
+        const char* keyword = ParameterUseKeywords[i].keyword;
+        size_t length = ::strlen(keyword);
+
+        if (position + length > s.length())
+            continue;
+
+        if (s[position] != keyword[0] && s[position] != keyword[0] - 'a' + 'A')
+            continue;
+
+        if (s.compare(position + 1, length - 1, keyword + 1) == 0)
+            return &ParameterUseKeywords[i];
+    }
+
+    return NULL;
+}
+
+/**
+ *  \brief Parse `(<use>, <type>, `<example>`)` traits
+ *
+ *  Traits are picked in order example value, use and type, each
+ *  together with its surrounding comma and blanks. Anything left
+ *  invalidates all of them.
+ */
+static void ParseTraits(std::string& traits,
+                        Parameter& parameter,
+                        ParameterSignatureComponents& components)
+{
+    TrimString(traits);
+
+    if (traits.empty())
+        return;
+
+    // Cherry pick example value, if any
+    size_t open = traits.find('`');
+    size_t close = (open != std::string::npos) ? traits.find('`', open + 1) : std::string::npos;
+
+    if (close != std::string::npos) {
+
+        parameter.exampleValue.assign(traits, open + 1, close - open - 1);
+        components |= ExampleValueParameterComponent;
+
+        size_t start = LeadInStart(traits, open);
+        traits.erase(start, LeadOutEnd(traits, close + 1) - start);
+    }
+
+    // Cherry pick use attribute, if any
+    for (size_t i = 0; i < traits.length(); ++i) {
+
+        const ParameterUseKeyword* keyword = ParameterUseKeywordAt(traits, i);
+
+        if (!keyword)
+            continue;
+
+        parameter.use = keyword->use;
+        components |= UseParameterComponent;
+
+        size_t start = LeadInStart(traits, i);
+        traits.erase(start, LeadOutEnd(traits, i + ::strlen(keyword->keyword)) - start);
+        break;
+    }
+
+    // Finish with type
+    if (!traits.empty()) {
+
+        size_t start = LeadOutEnd(traits, 0);
+        size_t end = traits.find(',', start);
+
+        if (end == std::string::npos)
+            end = traits.length();
+
+        parameter.type.assign(traits, start, end - start);
+        components |= TypeParameterComponent;
+
+        traits.erase(0, LeadOutEnd(traits, end));
+    }
+
+    // Check what is left
+    TrimString(traits);
+
+    if (!traits.empty()) {
+
+        parameter.type.clear();
+        parameter.exampleValue.clear();
+        parameter.use = UndefinedParameterUse;
+
+        components = InvalidTraitsParameterComponent;
+    }
+}
+
+bool snowcrash::ParseParameterSignature(const mdp::ByteBuffer& signature,
+                                        Parameter& parameter,
+                                        ParameterSignatureComponents& components)
+{
+    parameter.use = UndefinedParameterUse;
+    components = NoParameterComponent;
+
+    if (!IsValidParameterSignature(signature))
+        return false;
+
+    SignatureParts parts;
+    SplitSignature(signature, parts);
+
+    parameter.name.assign(signature, parts.name.begin, parts.name.end - parts.name.begin);
+
+    if (!parts.hasRest)
+        return true;
+
+    if (parts.hasDescription) {
+        parameter.description.assign(signature, parts.description.begin, parts.description.end - parts.description.begin);
+    }
+
+    if (parts.hasTraits) {
+
+        std::string traits(signature, parts.traits.begin, parts.traits.end - parts.traits.begin);
+        ParseTraits(traits, parameter, components);
+    }
+
+    if (!parts.inner.empty()) {
+
+        // Default value without `=` and backticks
+        std::string defaultValue;
+        defaultValue.reserve(parts.inner.end - parts.inner.begin);
+
+        for (size_t i = parts.inner.begin; i < parts.inner.end; ++i) {
+            if (signature[i] != '=' && signature[i] != '`')
+                defaultValue += signature[i];
+        }
+
+        parameter.defaultValue = TrimString(defaultValue);
+    }
+
+    return true;
+}
+
+bool snowcrash::ParseParameterValue(const mdp::ByteBuffer& content, Value& value)
+{
+    for (size_t open = content.find('`'); open != std::string::npos; open = content.find('`', open + 1)) {
+
+        if (open + 1 < content.length() && content[open + 1] != '`') {
+
+            size_t close = content.find('`', open + 1);
+
+            if (close == std::string::npos)
+                return false;
+
+            value.assign(content, open + 1, close - open - 1);
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,67 @@
+//
+//  ParameterSignature.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_PARAMETERSIGNATURE_H
+#define SNOWCRASH_PARAMETERSIGNATURE_H
+
+#include "Blueprint.h"
+#include "ByteBuffer.h"
+
+namespace snowcrash {
+
+    /**
+     *  \brief Components found in a parameter signature
+     *
+     *  Traits are only reported when they have all been understood,
+     *  otherwise just `InvalidTraitsParameterComponent` is set.
+     */
+    enum ParameterSignatureComponent {
+        NoParameterComponent = 0,
+        ExampleValueParameterComponent = (1 << 0),    /// < `(..., `example`)`
+        UseParameterComponent = (1 << 1),             /// < `(required | optional | readonly | writeonly, ...)`
+        TypeParameterComponent = (1 << 2),            /// < `(..., type, ...)`
+        InvalidTraitsParameterComponent = (1 << 3)    /// < Traits with text left unparsed
+    };
+
+    typedef unsigned int ParameterSignatureComponents;
+
+    /**
+     *  \brief Check a parameter signature
+     *
+     *  `<name> [= `<default value>`] [(<traits>)] [... <description>]`
+     *
+     *  \param signature    First line of a parameter list item
+     *  \return True if the signature is a parameter signature
+     */
+    bool IsValidParameterSignature(const mdp::ByteBuffer& signature);
+
+    /**
+     *  \brief Parse a parameter signature in one pass
+     *
+     *  Fills name, default value, description and traits of the parameter,
+     *  leaving the components not present in the signature untouched.
+     *
+     *  \param signature    First line of a parameter list item
+     *  \param parameter    Parameter to fill
+     *  \param components   Components found
+     *  \return False if the signature is not a parameter signature
+     */
+    bool ParseParameterSignature(const mdp::ByteBuffer& signature,
+                                 Parameter& parameter,
+                                 ParameterSignatureComponents& components);
+
+    /**
+     *  \brief Parse a parameter value list item
+     *  \param content  Text of the list item, e.g. '`value`'
+     *  \param value    The first non-empty value in backticks
+     *  \return False if there is no value in backticks
+     */
+    bool ParseParameterValue(const mdp::ByteBuffer& content, Value& value);
+}
+
+#endif
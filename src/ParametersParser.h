@@ -17,15 +17,6 @@
 
 namespace snowcrash {
 
-    /** Parameters matching regex */
-    const char* const ParametersRegex = "^[[:blank:]]*[Pp]arameters?[[:blank:]]*$";
-
-    /** Attributes matching regex */
-    const char* const AttributesRegex = "^[[:blank:]]*[Aa]ttributes?[[:blank:]]*$";
-
-    /** Members matching regex */
-    const char* const MembersRegex = "^[[:blank:]]*[Mm]embers?[[:blank:]]*$";
-
     /** No parameters specified message */
     const char* const NoParametersMessage = "no parameters specified, expected a nested list of parameters, one parameter per list item";
 
@@ -35,8 +26,8 @@ namespace snowcrash {
     /**
      * Parameters section processor
      */
-    template<>
-    struct SectionProcessor<Parameters> : public SectionProcessorBase<Parameters> {
+    template<typename SourceMapPolicy>
+    struct SectionProcessor<Parameters, SourceMapPolicy> : public SectionProcessorBase<Parameters, SourceMapPolicy> {
 
         static MarkdownNodeIterator processSignature(const MarkdownNodeIterator& node,
                                                      const MarkdownNodes& siblings,
@@ -83,7 +74,7 @@ namespace snowcrash {
 
             IntermediateParseResult<Parameter> parameter(out.report);
 
-            ParameterParser::parse(node, siblings, pd, parameter);
+            SectionParser<Parameter, ListSectionAdapter, SourceMapPolicy>::parse(node, siblings, pd, parameter);
 
             if (!out.node.empty()) {
 
@@ -104,7 +95,7 @@ namespace snowcrash {
 
             out.node.push_back(parameter.node);
 
-            if (pd.exportSourceMap()) {
+            if (SourceMapPolicy::exportSourceMap(pd)) {
                 out.sourceMap.collection.push_back(parameter.sourceMap);
             }
 
@@ -122,20 +113,18 @@ namespace snowcrash {
             if (node->type == mdp::ListItemMarkdownNodeType
                 && !node->children().empty()) {
 
-                mdp::ByteBuffer remaining, subject = node->children().front().text;
-
-                subject = GetFirstLine(subject, remaining);
-                TrimString(subject);
+                StringView remaining;
+                StringView subject = TrimView(FirstLineView(StringView(node->children().front().text), remaining));
 
-                if (RegexMatch(subject, ParametersRegex)) {
+                if (MatchSectionKeyword(subject, "Parameter", true)) {
                     return ParametersSectionType;
                 }
 
-                if (RegexMatch(subject, AttributesRegex)) {
+                if (MatchSectionKeyword(subject, "Attribute", true)) {
                     return AttributesSectionType;
                 }
 
-                if (RegexMatch(subject, MembersRegex)) {
+                if (MatchSectionKeyword(subject, "Member", true)) {
                     return MembersSectionType;
                 }
             }
@@ -145,7 +134,7 @@ namespace snowcrash {
 
         static SectionType nestedSectionType(const MarkdownNodeIterator& node) {
 
-            return SectionProcessor<Parameter>::sectionType(node);
+            return SectionProcessor<Parameter, SourceMapPolicy>::sectionType(node);
         }
 
         static SectionTypes nestedSectionTypes() {
@@ -153,7 +142,7 @@ namespace snowcrash {
 
             // Parameter & descendants
             nested.push_back(ParameterSectionType);
-            SectionTypes types = SectionProcessor<Parameter>::nestedSectionTypes();
+            SectionTypes types = SectionProcessor<Parameter, SourceMapPolicy>::nestedSectionTypes();
             nested.insert(nested.end(), types.begin(), types.end());
 
             return nested;
@@ -0,0 +1,296 @@
+//
+//  ParseStatistics.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <cstdio>
+#include <iomanip>
+#include "ParseStatistics.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__APPLE__)
+#include <mach/mach_time.h>
+#else
+#include <time.h>
+#endif
+
+#if defined(__GNUC__)
+#include <cxxabi.h>
+#include <cstdlib>
+#endif
+
+using namespace snowcrash;
+
+/** Statistics collected by the current thread */
+static SC_THREAD_LOCAL ParseStatistics* ActiveStatistics = NULL;
+
+void ParseStatistics::clear()
+{
+    regex.clear();
+    nodes.clear();
+    parsers.clear();
+    warnings.clear();
+    spans.clear();
+}
+
+void ParseStatistics::addSpan(const std::string& name, double start, double end)
+{
+    TraceSpan span;
+    span.name = name;
+    span.start = start;
+    span.duration = end - start;
+
+    spans.push_back(span);
+}
+
+bool ParseStatistics::isAvailable()
+{
+#ifdef SNOWCRASH_INSTRUMENTATION
+    return true;
+#else
+    return false;
+#endif
+}
+
+double ParseStatistics::now()
+{
+#if defined(_WIN32)
+    LARGE_INTEGER frequency, counter;
+    ::QueryPerformanceFrequency(&frequency);
+    ::QueryPerformanceCounter(&counter);
+
+    return (counter.QuadPart * 1000000.0) / frequency.QuadPart;
+#elif defined(__APPLE__)
+    mach_timebase_info_data_t timebase;
+    ::mach_timebase_info(&timebase);
+
+    return (::mach_absolute_time() * static_cast<double>(timebase.numer) / timebase.denom) / 1000.0;
+#else
+    struct timespec time;
+    ::clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return time.tv_sec * 1000000.0 + time.tv_nsec / 1000.0;
+#endif
+}
+
+ParseStatistics* ParseStatistics::active()
+{
+    return ActiveStatistics;
+}
+
+void ParseStatistics::setActive(ParseStatistics* statistics)
+{
+    ActiveStatistics = statistics;
+}
+
+ParseStatisticsScope::~ParseStatisticsScope()
+{
+    if (!m_statistics)
+        return;
+
+    double end = ParseStatistics::now();
+
+    ParseTimer& timer = m_statistics->parsers[m_name];
+    ++timer.calls;
+    timer.time += end - m_start;
+
+    m_statistics->addSpan(m_name, m_start, end);
+}
+
+RegexStatisticsScope::~RegexStatisticsScope()
+{
+    if (!m_statistics)
+        return;
+
+    ParseTimer& timer = m_statistics->regex[m_expression];
+    ++timer.calls;
+    timer.time += ParseStatistics::now() - m_start;
+}
+
+/** \returns Human-readable form of a (possibly mangled) type name */
+static std::string ReadableName(const std::string& name)
+{
+#if defined(__GNUC__)
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(name.c_str(), NULL, NULL, &status);
+
+    if (status == 0 && demangled) {
+        std::string result(demangled);
+        ::free(demangled);
+        return result;
+    }
+#endif
+
+    return name;
+}
+
+/** \returns JSON string literal of \param value */
+static std::string JSONString(const std::string& value)
+{
+    std::string result = "\"";
+
+    for (std::string::const_iterator it = value.begin(); it != value.end(); ++it) {
+
+        switch (*it) {
+            case '"':
+                result += "\\\"";
+                break;
+
+            case '\\':
+                result += "\\\\";
+                break;
+
+            case '\n':
+                result += "\\n";
+                break;
+
+            default:
+                if (static_cast<unsigned char>(*it) < 0x20) {
+                    char buffer[8];
+                    ::sprintf(buffer, "\\u%04x", static_cast<unsigned char>(*it));
+                    result += buffer;
+                }
+                else {
+                    result += *it;
+                }
+        }
+    }
+
+    return result + "\"";
+}
+
+void snowcrash::PrintStatistics(const ParseStatistics& statistics, std::ostream& stream)
+{
+    if (!ParseStatistics::isAvailable()) {
+        stream << "parse statistics are not available, rebuild with instrumentation enabled\n";
+        return;
+    }
+
+    std::ios_base::fmtflags flags = stream.flags();
+    std::streamsize precision = stream.precision(1);
+    stream << std::fixed;
+
+    stream << "parsers (calls, inclusive time us):\n";
+    for (ParseStatistics::ParserTimers::const_iterator it = statistics.parsers.begin();
+         it != statistics.parsers.end();
+         ++it) {
+
+        stream << "  " << std::setw(8) << it->second.calls << std::setw(14) << it->second.time;
+        stream << "  " << ReadableName(it->first) << "\n";
+    }
+
+    stream << "nodes visited per section:\n";
+    for (ParseStatistics::SectionCounters::const_iterator it = statistics.nodes.begin();
+         it != statistics.nodes.end();
+         ++it) {
+
+        stream << "  " << std::setw(8) << it->second << "  " << SectionTypeToString(it->first) << "\n";
+    }
+
+    stream << "regex (calls, time us):\n";
+    for (ParseStatistics::RegexTimers::const_iterator it = statistics.regex.begin();
+         it != statistics.regex.end();
+         ++it) {
+
+        stream << "  " << std::setw(8) << it->second.calls << std::setw(14) << it->second.time;
+        stream << "  " << it->first << "\n";
+    }
+
+    stream << "warnings per code:\n";
+    for (ParseStatistics::WarningCounters::const_iterator it = statistics.warnings.begin();
+         it != statistics.warnings.end();
+         ++it) {
+
+        stream << "  " << std::setw(8) << it->second << "  " << it->first << "\n";
+    }
+
+    stream.flags(flags);
+    stream.precision(precision);
+}
+
+void snowcrash::SerializeStatisticsJSON(const ParseStatistics& statistics, std::ostream& stream)
+{
+    stream << "{\n  \"available\": " << (ParseStatistics::isAvailable() ? "true" : "false") << ",\n";
+
+    stream << "  \"parsers\": [";
+    for (ParseStatistics::ParserTimers::const_iterator it = statistics.parsers.begin();
+         it != statistics.parsers.end();
+         ++it) {
+
+        stream << ((it == statistics.parsers.begin()) ? "\n" : ",\n");
+        stream << "    { \"name\": " << JSONString(ReadableName(it->first));
+        stream << ", \"calls\": " << it->second.calls << ", \"time\": " << it->second.time << " }";
+    }
+    stream << "\n  ],\n";
+
+    stream << "  \"nodes\": [";
+    for (ParseStatistics::SectionCounters::const_iterator it = statistics.nodes.begin();
+         it != statistics.nodes.end();
+         ++it) {
+
+        stream << ((it == statistics.nodes.begin()) ? "\n" : ",\n");
+        stream << "    { \"section\": " << JSONString(SectionTypeToString(it->first));
+        stream << ", \"count\": " << it->second << " }";
+    }
+    stream << "\n  ],\n";
+
+    stream << "  \"regex\": [";
+    for (ParseStatistics::RegexTimers::const_iterator it = statistics.regex.begin();
+         it != statistics.regex.end();
+         ++it) {
+
+        stream << ((it == statistics.regex.begin()) ? "\n" : ",\n");
+        stream << "    { \"expression\": " << JSONString(it->first);
+        stream << ", \"calls\": " << it->second.calls << ", \"time\": " << it->second.time << " }";
+    }
+    stream << "\n  ],\n";
+
+    stream << "  \"warnings\": [";
+    for (ParseStatistics::WarningCounters::const_iterator it = statistics.warnings.begin();
+         it != statistics.warnings.end();
+         ++it) {
+
+        stream << ((it == statistics.warnings.begin()) ? "\n" : ",\n");
+        stream << "    { \"code\": " << it->first << ", \"count\": " << it->second << " }";
+    }
+    stream << "\n  ]\n}\n";
+}
+
+void snowcrash::SerializeTraceEventsJSON(const ParseStatistics& statistics, std::ostream& stream)
+{
+    std::ios_base::fmtflags flags = stream.flags();
+    std::streamsize precision = stream.precision(3);
+    stream << std::fixed;
+
+    // Timestamps relative to the earliest span
+    double origin = 0;
+    for (ParseStatistics::TraceSpans::const_iterator it = statistics.spans.begin();
+         it != statistics.spans.end();
+         ++it) {
+
+        if (it == statistics.spans.begin() || it->start < origin)
+            origin = it->start;
+    }
+
+    stream << "{\n  \"traceEvents\": [";
+
+    for (ParseStatistics::TraceSpans::const_iterator it = statistics.spans.begin();
+         it != statistics.spans.end();
+         ++it) {
+
+        stream << ((it == statistics.spans.begin()) ? "\n" : ",\n");
+        stream << "    { \"name\": " << JSONString(ReadableName(it->name));
+        stream << ", \"cat\": \"snowcrash\", \"ph\": \"X\"";
+        stream << ", \"ts\": " << (it->start - origin) << ", \"dur\": " << it->duration;
+        stream << ", \"pid\": 1, \"tid\": 1 }";
+    }
+
+    stream << "\n  ],\n  \"displayTimeUnit\": \"ms\"\n}\n";
+
+    stream.flags(flags);
+    stream.precision(precision);
+}
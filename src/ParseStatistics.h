@@ -0,0 +1,190 @@
+//
+//  ParseStatistics.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_PARSESTATISTICS_H
+#define SNOWCRASH_PARSESTATISTICS_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include <ostream>
+#include "Platform.h"
+#include "Section.h"
+
+/**
+ *  Parser Instrumentation
+ *  ----------------------
+ *
+ *  Instrumentation hooks are compiled out unless the library is built
+ *  with `SNOWCRASH_INSTRUMENTATION` defined (`./configure --instrumentation`).
+ *  Without it the statistics are never populated.
+ */
+
+namespace snowcrash {
+
+    /** Number of calls and time spent in them */
+    struct ParseTimer {
+
+        ParseTimer() : calls(0), time(0) {}
+
+        /** Number of calls */
+        size_t calls;
+
+        /** Total time in microseconds */
+        double time;
+    };
+
+    /** A timed parser span */
+    struct TraceSpan {
+
+        /** Name of the span */
+        std::string name;
+
+        /** Start in microseconds, see ParseStatistics::now() */
+        double start;
+
+        /** Duration in microseconds */
+        double duration;
+    };
+
+    /**
+     *  \brief Parse Statistics
+     *
+     *  Counters and timers collected during one or more parser runs.
+     */
+    struct ParseStatistics {
+
+        /** Regex evaluations per regular expression */
+        typedef std::map<std::string, ParseTimer> RegexTimers;
+        RegexTimers regex;
+
+        /** Markdown nodes visited per section type */
+        typedef std::map<SectionType, size_t> SectionCounters;
+        SectionCounters nodes;
+
+        /** Time spent per parsing stage or SectionParser instantiation, keyed by name */
+        typedef std::map<std::string, ParseTimer> ParserTimers;
+        ParserTimers parsers;
+
+        /** Warnings emitted per warning code */
+        typedef std::map<int, size_t> WarningCounters;
+        WarningCounters warnings;
+
+        /** Parser spans in order of completion */
+        typedef std::vector<TraceSpan> TraceSpans;
+        TraceSpans spans;
+
+        /** Clear all collected data */
+        void clear();
+
+        /** Record a completed span, \param start and \param end in microseconds */
+        void addSpan(const std::string& name, double start, double end);
+
+        /** \returns True if the library was built with instrumentation */
+        static bool isAvailable();
+
+        /** \returns Monotonic time in microseconds */
+        static double now();
+
+        /** \returns Statistics collected by the current thread, NULL if none */
+        static ParseStatistics* active();
+
+        /** Set statistics collected by the current thread */
+        static void setActive(ParseStatistics* statistics);
+    };
+
+    /**
+     *  \brief Collect statistics on the current thread for the lifetime of the scope
+     */
+    struct ActiveParseStatistics {
+
+        ActiveParseStatistics(ParseStatistics* statistics)
+        : m_previous(ParseStatistics::active()) {
+
+            ParseStatistics::setActive(statistics);
+        }
+
+        ~ActiveParseStatistics() {
+            ParseStatistics::setActive(m_previous);
+        }
+
+    private:
+        ParseStatistics* m_previous;
+
+        ActiveParseStatistics(const ActiveParseStatistics&);
+        ActiveParseStatistics& operator=(const ActiveParseStatistics&);
+    };
+
+    /**
+     *  \brief Time a scope and record it as a span of given name
+     */
+    struct ParseStatisticsScope {
+
+        ParseStatisticsScope(ParseStatistics* statistics, const char* name)
+        : m_statistics(statistics), m_name(name), m_start(statistics ? ParseStatistics::now() : 0) {}
+
+        ~ParseStatisticsScope();
+
+    private:
+        ParseStatistics* m_statistics;
+        const char* m_name;
+        double m_start;
+
+        ParseStatisticsScope(const ParseStatisticsScope&);
+        ParseStatisticsScope& operator=(const ParseStatisticsScope&);
+    };
+
+    /**
+     *  \brief Count and time a regex evaluation in the active statistics
+     */
+    struct RegexStatisticsScope {
+
+        RegexStatisticsScope(const std::string& expression)
+        : m_statistics(ParseStatistics::active()), m_expression(expression), m_start(m_statistics ? ParseStatistics::now() : 0) {}
+
+        ~RegexStatisticsScope();
+
+    private:
+        ParseStatistics* m_statistics;
+        const std::string& m_expression;
+        double m_start;
+
+        RegexStatisticsScope(const RegexStatisticsScope&);
+        RegexStatisticsScope& operator=(const RegexStatisticsScope&);
+    };
+
+    /** Print statistics in human-readable form */
+    void PrintStatistics(const ParseStatistics& statistics, std::ostream& stream);
+
+    /** Serialize counters and timers into JSON */
+    void SerializeStatisticsJSON(const ParseStatistics& statistics, std::ostream& stream);
+
+    /** Serialize spans into Chrome trace-event JSON (chrome://tracing) */
+    void SerializeTraceEventsJSON(const ParseStatistics& statistics, std::ostream& stream);
+}
+
+#ifdef SNOWCRASH_INSTRUMENTATION
+
+#define SC_INSTRUMENT_SCOPE(STATISTICS, NAME) \
+    snowcrash::ParseStatisticsScope _instrumentationScope(STATISTICS, NAME)
+
+#define SC_INSTRUMENT_NODE(STATISTICS, SECTION) \
+    do { if (STATISTICS) ++(STATISTICS)->nodes[SECTION]; } while (0)
+
+#define SC_INSTRUMENT_REGEX(EXPRESSION) \
+    snowcrash::RegexStatisticsScope _instrumentationRegex(EXPRESSION)
+
+#else
+
+#define SC_INSTRUMENT_SCOPE(STATISTICS, NAME)
+#define SC_INSTRUMENT_NODE(STATISTICS, SECTION)
+#define SC_INSTRUMENT_REGEX(EXPRESSION)
+
+#endif
+
+#endif
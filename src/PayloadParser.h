@@ -14,9 +14,7 @@
 #include "AssetParser.h"
 #include "HeadersParser.h"
 #include "ParametersParser.h"
-
-/** Media type in brackets regex */
-#define MEDIA_TYPE "([[:blank:]]*\\(([^\\)]*)\\))"
+#include "PayloadSignature.h"
 
 namespace snowcrash {
 
@@ -24,33 +22,11 @@ namespace snowcrash {
     typedef Collection<Response>::const_iterator ResponseIterator;
     typedef Collection<Request>::const_iterator RequestIterator;
 
-    /// Payload signature
-    enum PayloadSignature {
-        NoPayloadSignature = 0,
-        RequestPayloadSignature,    /// < Request payload.
-        ResponsePayloadSignature,   /// < Response payload.
-        ModelPayloadSignature,      /// < Resource Model payload.
-        SamplePayloadSignature,     /// < Data Structure Sample payload.
-        UndefinedPayloadSignature = -1
-    };
-
-    /** Request matching regex */
-    const char* const RequestRegex = "^[[:blank:]]*[Rr]equest" SYMBOL_IDENTIFIER "?" MEDIA_TYPE "?[[:blank:]]*";
-
-    /** Response matching regex */
-    const char* const ResponseRegex = "^[[:blank:]]*[Rr]esponse([[:blank:][:digit:]]+)?" MEDIA_TYPE "?[[:blank:]]*";
-
-    /** Model matching regex */
-    const char* const  ModelRegex = "^[[:blank:]]*(" SYMBOL_IDENTIFIER "[[:blank:]]+)?[Mm]odel" MEDIA_TYPE "?[[:blank:]]*$";
-
-    /** Sample matching regex */
-    const char* const SampleRegex = "^[[:blank:]]*[Ss]ample" SYMBOL_IDENTIFIER "?" MEDIA_TYPE "?[[:blank:]]*";
-
     /**
      * Payload Section Processor
      */
-    template<>
-    struct SectionProcessor<Payload> : public SectionProcessorBase<Payload> {
+    template<typename SourceMapPolicy>
+    struct SectionProcessor<Payload, SourceMapPolicy> : public SectionProcessorBase<Payload, SourceMapPolicy> {
 
         static MarkdownNodeIterator processSignature(const MarkdownNodeIterator& node,
                                                      const MarkdownNodes& siblings,
@@ -58,10 +34,10 @@ namespace snowcrash {
                                                      SectionLayout& layout,
                                                      const ParseResultRef<Payload>& out) {
 
-            mdp::ByteBuffer signature, remainingContent;
-            signature = GetFirstLine(node->text, remainingContent);
+            StringView remainingContent;
+            FirstLineView(StringView(node->text), remainingContent);
 
-            parseSignature(node, pd, signature, out);
+            parseSignature(node, pd, node->text, out);
 
             // WARN: missing status code
             if (out.node.name.empty() &&
@@ -74,23 +50,40 @@ namespace snowcrash {
                 out.node.name = "200";
             }
 
+            if (pd.sectionContext() == ResponseSectionType || pd.sectionContext() == ResponseBodySectionType) {
+                out.node.statusCode = GetHTTPStatusCode(out.node.name);
+            }
+
             if (!remainingContent.empty()) {
                 if (!isAbbreviated(pd.sectionContext())) {
-                    out.node.description = remainingContent;
 
-                    if (pd.exportSourceMap() && !out.node.description.empty()) {
-                        out.sourceMap.description.sourceMap.append(node->sourceMap);
+                    if (pd.skip(SkipDescriptionsOption)) {
+
+                        if (pd.hasSourceData(node->sourceMap))
+                            out.sourceMap.description.sourceMap.append(node->sourceMap);
+                    } else {
+                        out.node.description = remainingContent.str();
+
+                        if (SourceMapPolicy::exportSourceMap(pd) && !out.node.description.empty()) {
+                            out.sourceMap.description.sourceMap.append(node->sourceMap);
+                        }
                     }
-                } else if (!parseSymbolReference(node, pd, remainingContent, out)) {
+                } else {
+                    mdp::ByteBuffer content = remainingContent.str();
 
-                    // NOTE: NOT THE CORRECT WAY TO DO THIS
-                    // https://github.com/apiaryio/snowcrash/commit/a7c5868e62df0048a85e2f9aeeb42c3b3e0a2f07#commitcomment-7322085
-                    pd.sectionsContext.push_back(BodySectionType);
-                    CodeBlockUtility::signatureContentAsCodeBlock(node, pd, out.report, out.node.body);
-                    pd.sectionsContext.pop_back();
+                    if (!parseSymbolReference(node, pd, content, out)) {
 
-                    if (pd.exportSourceMap() && !out.node.body.empty()) {
-                        out.sourceMap.body.sourceMap.append(node->sourceMap);
+                        // NOTE: NOT THE CORRECT WAY TO DO THIS
+                        // https://github.com/apiaryio/snowcrash/commit/a7c5868e62df0048a85e2f9aeeb42c3b3e0a2f07#commitcomment-7322085
+                        bool skip = pd.skip(SkipBodiesOption);
+
+                        pd.sectionsContext.push_back(BodySectionType);
+                        bool added = CodeBlockUtility::signatureContentAsCodeBlock(node, pd, out.report, skip ? NULL : &out.node.body);
+                        pd.sectionsContext.pop_back();
+
+                        if ((SourceMapPolicy::exportSourceMap(pd) || skip) && added) {
+                            out.sourceMap.body.sourceMap.append(node->sourceMap);
+                        }
                     }
                 }
             }
@@ -103,8 +96,6 @@ namespace snowcrash {
                                                    SectionParserData& pd,
                                                    const ParseResultRef<Payload>& out) {
 
-            mdp::ByteBuffer content;
-
             if (!out.node.reference.id.empty()) {
                 //WARN: ignoring extraneous content after symbol reference
                 std::stringstream ss;
@@ -118,19 +109,19 @@ namespace snowcrash {
                                                       sourceMap));
             } else {
 
-                if (!out.node.body.empty() ||
+                if (hasBody(pd, out.node, out.sourceMap) ||
                     node->type != mdp::ParagraphMarkdownNodeType ||
                     !parseSymbolReference(node, pd, node->text, out)) {
 
                     // NOTE: NOT THE CORRECT WAY TO DO THIS
                     // https://github.com/apiaryio/snowcrash/commit/a7c5868e62df0048a85e2f9aeeb42c3b3e0a2f07#commitcomment-7322085
+                    bool skip = pd.skip(SkipBodiesOption);
+
                     pd.sectionsContext.push_back(BodySectionType);
-                    CodeBlockUtility::contentAsCodeBlock(node, pd, out.report, content);
+                    bool added = CodeBlockUtility::contentAsCodeBlock(node, pd, out.report, skip ? NULL : &out.node.body);
                     pd.sectionsContext.pop_back();
 
-                    out.node.body += content;
-
-                    if (pd.exportSourceMap() && !content.empty()) {
+                    if ((SourceMapPolicy::exportSourceMap(pd) || skip) && added) {
                         out.sourceMap.body.sourceMap.append(node->sourceMap);
                     }
                 }
@@ -148,24 +139,24 @@ namespace snowcrash {
                 case ParametersSectionType:
                 {
                     ParseResultRef<Parameters> parameters(out.report, out.node.parameters, out.sourceMap.parameters);
-                    return ParametersParser::parse(node, siblings, pd, parameters);
+                    return SectionParser<Parameters, ListSectionAdapter, SourceMapPolicy>::parse(node, siblings, pd, parameters);
                 }
 
                 case AttributesSectionType:
                 {
                     ParseResultRef<Parameters> parameters(out.report, out.node.attributes, out.sourceMap.attributes);
-                    return ParametersParser::parse(node, siblings, pd, parameters);
+                    return SectionParser<Parameters, ListSectionAdapter, SourceMapPolicy>::parse(node, siblings, pd, parameters);
                 }
 
                 case HeadersSectionType:
                 {
                     ParseResultRef<Headers> headers(out.report, out.node.headers, out.sourceMap.headers);
-                    return HeadersParser::parse(node, siblings, pd, headers);
+                    return SectionParser<Headers, ListSectionAdapter, SourceMapPolicy>::parse(node, siblings, pd, headers);
                 }
 
                 case BodySectionType:
                 {
-                    if (!out.node.body.empty()) {
+                    if (hasBody(pd, out.node, out.sourceMap)) {
                         // WARN: Multiple body section
                         mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
                         out.report.warnings.push_back(Warning("ignoring additional 'body' content, it is already defined",
@@ -174,12 +165,13 @@ namespace snowcrash {
                     }
 
                     ParseResultRef<Asset> asset(out.report, out.node.body, out.sourceMap.body);
-                    return AssetParser::parse(node, siblings, pd, asset);
+                    return SectionParser<Asset, ListSectionAdapter, SourceMapPolicy>::parse(node, siblings, pd, asset);
                 }
 
                 case SchemaSectionType:
                 {
-                    if (!out.node.schema.empty()) {
+                    if (!out.node.schema.empty() ||
+                        (pd.skip(SkipSchemasOption) && !out.sourceMap.schema.sourceMap.empty())) {
                         // WARN: Multiple schema section
                         mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
                         out.report.warnings.push_back(Warning("ignoring additional 'schema' content, it is already defined",
@@ -188,7 +180,7 @@ namespace snowcrash {
                     }
 
                     ParseResultRef<Asset> asset(out.report, out.node.schema, out.sourceMap.schema);
-                    return AssetParser::parse(node, siblings, pd, asset);
+                    return SectionParser<Asset, ListSectionAdapter, SourceMapPolicy>::parse(node, siblings, pd, asset);
                 }
 
                 default:
@@ -208,23 +200,24 @@ namespace snowcrash {
                  node->type == mdp::CodeMarkdownNodeType) &&
                 sectionType == BodySectionType) {
 
-                mdp::ByteBuffer content = CodeBlockUtility::addDanglingAsset(node, pd, sectionType, out.report, out.node.body);
+                bool skip = pd.skip(SkipBodiesOption);
+                bool added = CodeBlockUtility::addDanglingAsset(node, pd, sectionType, out.report, skip ? NULL : &out.node.body);
 
-                if (pd.exportSourceMap() && !content.empty()) {
+                if ((SourceMapPolicy::exportSourceMap(pd) || skip) && added) {
                     out.sourceMap.body.sourceMap.append(node->sourceMap);
                 }
 
                 return ++MarkdownNodeIterator(node);
             }
 
-            return SectionProcessorBase<Payload>::processUnexpectedNode(node, siblings, pd, sectionType, out);
+            return SectionProcessorBase<Payload, SourceMapPolicy>::processUnexpectedNode(node, siblings, pd, sectionType, out);
         }
 
         static bool isDescriptionNode(const MarkdownNodeIterator& node,
                                       SectionType sectionType) {
 
             if (!isAbbreviated(sectionType) &&
-                SectionProcessorBase<Payload>::isDescriptionNode(node, sectionType)) {
+                SectionProcessorBase<Payload, SourceMapPolicy>::isDescriptionNode(node, sectionType)) {
 
                 return true;
             }
@@ -279,21 +272,21 @@ namespace snowcrash {
             SectionType nestedType = UndefinedSectionType;
 
             // Check if parameters section
-            nestedType = SectionProcessor<Parameters>::sectionType(node);
+            nestedType = SectionProcessor<Parameters, SourceMapPolicy>::sectionType(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if headers section
-            nestedType = SectionProcessor<Headers>::sectionType(node);
+            nestedType = SectionProcessor<Headers, SourceMapPolicy>::sectionType(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if asset section
-            nestedType = SectionProcessor<Asset>::sectionType(node);
+            nestedType = SectionProcessor<Asset, SourceMapPolicy>::sectionType(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
@@ -311,7 +304,7 @@ namespace snowcrash {
 
             // Parameters & descendants
             nested.push_back(ParametersSectionType);
-            types = SectionProcessor<Parameters>::nestedSectionTypes();
+            types = SectionProcessor<Parameters, SourceMapPolicy>::nestedSectionTypes();
             nested.insert(nested.end(), types.begin(), types.end());
 
             return nested;
@@ -330,31 +323,49 @@ namespace snowcrash {
 
                 checkResponse(node, pd, out);
             }
+
+            if (pd.events)
+                pd.events->payload(out.node, sectionType);
         }
 
-        /** Resolve payload signature */
-        static PayloadSignature payloadSignature(const MarkdownNodeIterator& node) {
+        /**
+         *  \brief  Check whether a payload has a body, including a body dropped by `SkipBodiesOption`.
+         *
+         *  A skipped body is told by its source map, the body of a referred
+         *  model by the source map of the model.
+         *
+         *  \param  payload     The payload to check
+         *  \param  sourceMap   Source map of the payload
+         */
+        static bool hasBody(const SectionParserData& pd,
+                            const Payload& payload,
+                            const SourceMap<Payload>& sourceMap) {
+
+            if (!payload.body.empty())
+                return true;
 
-            mdp::ByteBuffer subject = node->children().front().text;
-            mdp::ByteBuffer signature;
-            mdp::ByteBuffer remainingContent;
+            if (!pd.skip(SkipBodiesOption))
+                return false;
 
-            signature = GetFirstLine(subject, remainingContent);
-            TrimString(signature);
+            if (payload.reference.meta.state == Reference::StateResolved) {
 
-            if (RegexMatch(signature, RequestRegex))
-                return RequestPayloadSignature;
+                ResourceModelSymbolSourceMapTable::const_iterator it = pd.symbolSourceMapTable.resourceModels.find(payload.reference.id);
 
-            if (RegexMatch(signature, ResponseRegex))
-                return ResponsePayloadSignature;
+                return it != pd.symbolSourceMapTable.resourceModels.end() && !it->second.body.sourceMap.empty();
+            }
 
-            if (RegexMatch(signature, ModelRegex))
-                return ModelPayloadSignature;
+            return !sourceMap.body.sourceMap.empty();
+        }
 
-            if (RegexMatch(signature, SampleRegex))
-                return SamplePayloadSignature;
+        /**
+         *  \brief Resolve payload signature
+         *
+         *  The classification is kept by the active %PayloadSignatureCache,
+         *  parseSignature() takes it from there when the section is processed.
+         */
+        static PayloadSignature payloadSignature(const MarkdownNodeIterator& node) {
 
-            return NoPayloadSignature;
+            return ClassifyPayloadSignature(node->children().front().text).signature;
         }
 
         /** Get SectionType from PayloadSignature and nestedSectionType */
@@ -396,111 +407,91 @@ namespace snowcrash {
                                    const mdp::ByteBuffer& signature,
                                    const ParseResultRef<Payload>& out) {
 
-            const char* regex;
-            mdp::ByteBuffer mediaType;
-            CaptureGroups captureGroups;
+            PayloadSignature expected;
 
             switch (pd.sectionContext()) {
                 case RequestSectionType:
                 case RequestBodySectionType:
-                    regex = RequestRegex;
+                    expected = RequestPayloadSignature;
                     break;
 
                 case ResponseSectionType:
                 case ResponseBodySectionType:
-                    regex = ResponseRegex;
+                    expected = ResponsePayloadSignature;
                     break;
 
                 case ModelSectionType:
                 case ModelBodySectionType:
-                    regex = ModelRegex;
+                    expected = ModelPayloadSignature;
                     break;
 
                 case SampleSectionType:
                 case SampleBodySectionType:
-                    regex = SampleRegex;
+                    expected = SamplePayloadSignature;
                     break;
 
                 default:
                     return true;
             }
 
-            if (RegexCapture(signature, regex, captureGroups, 5) &&
-                !captureGroups.empty()) {
-
-                mdp::ByteBuffer target = signature;
-                mdp::ByteBuffer::size_type pos = target.find(captureGroups[0]);
-
-                if (pos != mdp::ByteBuffer::npos) {
-                    target.replace(pos, captureGroups[0].length(), mdp::ByteBuffer());
-                }
-
-                TrimString(target);
+            ClassifiedPayloadSignature classified = ClassifyPayloadSignature(signature);
 
-                if (!target.empty()) {
-                    // WARN: unable to parse payload signature
-                    std::stringstream ss;
-                    ss << "unable to parse " << SectionName(pd.sectionContext()) << " signature, expected ";
-
-                    switch (pd.sectionContext()) {
-                        case RequestSectionType:
-                        case RequestBodySectionType:
-                            ss << "'request [<identifier>] [(<media type>)]'";
-                            break;
-
-                        case ResponseBodySectionType:
-                        case ResponseSectionType:
-                            ss << "'response [<HTTP status code>] [(<media type>)]'";
-                            break;
-
-                        case ModelSectionType:
-                        case ModelBodySectionType:
-                            ss << "'model [(<media type>)]'";
-                            break;
-
-                        case SampleSectionType:
-                        case SampleBodySectionType:
-                            ss << "'sample [<identifier>] [(<media type>)]'";
-                            break;
-
-                        default:
-                            return false;
-                    }
-
-                    mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
-                    out.report.warnings.push_back(Warning(ss.str(),
-                                                          FormattingWarning,
-                                                          sourceMap));
+            if (classified.signature != expected)
+                return true;
 
-                    return false;
+            if (classified.hasRemainder) {
+                // WARN: unable to parse payload signature
+                std::stringstream ss;
+                ss << "unable to parse " << SectionName(pd.sectionContext()) << " signature, expected ";
+
+                switch (pd.sectionContext()) {
+                    case RequestSectionType:
+                    case RequestBodySectionType:
+                        ss << "'request [<identifier>] [(<media type>)]'";
+                        break;
+
+                    case ResponseBodySectionType:
+                    case ResponseSectionType:
+                        ss << "'response [<HTTP status code>] [(<media type>)]'";
+                        break;
+
+                    case ModelSectionType:
+                    case ModelBodySectionType:
+                        ss << "'model [(<media type>)]'";
+                        break;
+
+                    case SampleSectionType:
+                    case SampleBodySectionType:
+                        ss << "'sample [<identifier>] [(<media type>)]'";
+                        break;
+
+                    default:
+                        return false;
                 }
 
-                if (pd.sectionContext() == ModelSectionType ||
-                    pd.sectionContext() == ModelBodySectionType) {
+                mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
+                out.report.warnings.push_back(Warning(ss.str(),
+                                                      FormattingWarning,
+                                                      sourceMap));
 
-                    out.node.name = captureGroups[2];
-                    mediaType = captureGroups[4];
-                } else {
-                    out.node.name = captureGroups[1];
-                    mediaType = captureGroups[3];
-                }
+                return false;
+            }
 
-                TrimString(out.node.name);
-                TrimString(mediaType);
+            out.node.name.assign(signature, classified.identifier.location, classified.identifier.length);
 
-                if (pd.exportSourceMap() && !out.node.name.empty()) {
-                    out.sourceMap.name.sourceMap = node->sourceMap;
-                }
+            if (SourceMapPolicy::exportSourceMap(pd) && !out.node.name.empty()) {
+                out.sourceMap.name.sourceMap = node->sourceMap;
+            }
 
-                if (!mediaType.empty()) {
-                    Header header = std::make_pair(HTTPHeaderName::ContentType, mediaType);
-                    out.node.headers.push_back(header);
+            if (classified.mediaType.length != 0) {
+                Header header = std::make_pair(HTTPHeaderName::ContentType,
+                                               signature.substr(classified.mediaType.location, classified.mediaType.length));
+                out.node.headers.push_back(header);
 
-                    if (pd.exportSourceMap()) {
-                        SourceMap<Header> headerSM;
-                        headerSM.sourceMap = node->sourceMap;
-                        out.sourceMap.headers.collection.push_back(headerSM);
-                    }
+                if (SourceMapPolicy::exportSourceMap(pd)) {
+                    SourceMap<Header> headerSM;
+                    headerSM.sourceMap = node->sourceMap;
+                    out.sourceMap.headers.collection.push_back(headerSM);
                 }
             }
 
@@ -523,7 +514,7 @@ namespace snowcrash {
                 out.node.reference.meta.node = node;
                 out.node.reference.type = Reference::SymbolReference;
 
-                if (pd.exportSourceMap() && !symbol.empty()) {
+                if (SourceMapPolicy::exportSourceMap(pd) && !symbol.empty()) {
                     out.sourceMap.reference.sourceMap = node->sourceMap;
                 }
 
@@ -553,8 +544,7 @@ namespace snowcrash {
         static void assingReferredPayload(SectionParserData& pd,
                                           const ParseResultRef<Payload>& out) {
 
-            SourceMap<ResourceModel> modelSM;
-            ResourceModel model = pd.symbolTable.resourceModels.at(out.node.reference.id);
+            const ResourceModel& model = pd.symbolTable.resourceModels.at(out.node.reference.id);
 
 
             out.node.description = model.description;
@@ -591,9 +581,9 @@ namespace snowcrash {
             out.node.body = model.body;
             out.node.schema = model.schema;
 
-            if (pd.exportSourceMap()) {
+            if (SourceMapPolicy::exportSourceMap(pd)) {
 
-                modelSM = pd.symbolSourceMapTable.resourceModels.at(out.node.reference.id);
+                const SourceMap<ResourceModel>& modelSM = pd.symbolSourceMapTable.resourceModels.at(out.node.reference.id);
 
                 out.sourceMap.description = modelSM.description;
                 out.sourceMap.parameters = modelSM.parameters;
@@ -636,7 +626,7 @@ namespace snowcrash {
                 }
             }
 
-            if (out.node.body.empty() && out.node.reference.meta.state != Reference::StatePending) {
+            if (!hasBody(pd, out.node, out.sourceMap) && out.node.reference.meta.state != Reference::StatePending) {
 
                 // Warn when content-length or transfer-encoding is specified or both headers and body are empty
                 if (out.node.headers.empty()) {
@@ -675,16 +665,12 @@ namespace snowcrash {
                                   SectionParserData& pd,
                                   const ParseResultRef<Payload>& out) {
 
-            HTTPStatusCode code = 200;
-
-            if (!out.node.name.empty()) {
-                std::stringstream(out.node.name) >> code;
-            }
+            HTTPStatusCode code = out.node.name.empty() ? 200 : out.node.statusCode;
 
             StatusCodeTraits statusCodeTraits = GetStatusCodeTrait(code);
 
             if (!statusCodeTraits.allowBody &&
-                !out.node.body.empty() &&
+                hasBody(pd, out.node, out.sourceMap) &&
                 out.node.reference.meta.state != Reference::StatePending) {
 
                 // WARN: not empty body
@@ -0,0 +1,244 @@
+//
+//  PayloadSignature.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "PayloadSignature.h"
+#include "StringUtility.h"
+#include "Platform.h"
+
+using namespace snowcrash;
+
+/** Payload signature cache used by the current thread */
+static SC_THREAD_LOCAL PayloadSignatureCache* ActiveCache = NULL;
+
+PayloadSignatureCache* PayloadSignatureCache::active()
+{
+    return ActiveCache;
+}
+
+void PayloadSignatureCache::setActive(PayloadSignatureCache* cache)
+{
+    ActiveCache = cache;
+}
+
+static inline bool IsBlank(char c)
+{
+    return c == ' ' || c == '\t';
+}
+
+static inline bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+/** \returns True for characters not allowed in a symbol identifier */
+static inline bool IsSymbolBracket(char c)
+{
+    return c == '[' || c == ']' || c == '(' || c == ')';
+}
+
+/** \returns True if the keyword, with case-insensitive first letter, is at position */
+static bool IsKeywordAt(const mdp::ByteBuffer& s, size_t position, size_t end, const char* keyword, size_t length)
+{
+    if (position + length > end)
+        return false;
+
+    if (s[position] != keyword[0] && s[position] != keyword[0] - 'a' + 'A')
+        return false;
+
+    return s.compare(position + 1, length - 1, keyword + 1) == 0;
+}
+
+/** \returns Range of [begin, end) with white space trimmed */
+static mdp::BytesRange TrimmedRange(const mdp::ByteBuffer& s, size_t begin, size_t end)
+{
+    while (begin < end && isSpace(s[begin]))
+        ++begin;
+
+    while (end > begin && isSpace(s[end - 1]))
+        --end;
+
+    return mdp::BytesRange(begin, end - begin);
+}
+
+/** \returns Position of `)` closing a media type opened at position, `end` if none */
+static size_t MediaTypeClose(const mdp::ByteBuffer& s, size_t open, size_t end)
+{
+    for (size_t i = open + 1; i < end; ++i) {
+
+        if (s[i] == ')')
+            return i;
+
+        // Backslash has never been allowed in media type
+        if (s[i] == '\\')
+            return end;
+    }
+
+    return end;
+}
+
+/**
+ *  \brief Parse `[<identifier>] [(<media type>)]` following a keyword
+ *  \param isIdentifierCharacter    Characters allowed in the identifier
+ */
+static void ParseKeywordTail(const mdp::ByteBuffer& s,
+                             size_t position,
+                             size_t end,
+                             bool isIdentifierCharacter(char),
+                             ClassifiedPayloadSignature& result)
+{
+    size_t identifierEnd = position;
+
+    while (identifierEnd < end && isIdentifierCharacter(s[identifierEnd]))
+        ++identifierEnd;
+
+    result.identifier = TrimmedRange(s, position, identifierEnd);
+    position = identifierEnd;
+
+    size_t open = position;
+
+    while (open < end && IsBlank(s[open]))
+        ++open;
+
+    if (open < end && s[open] == '(') {
+
+        size_t close = MediaTypeClose(s, open, end);
+
+        if (close != end) {
+            result.mediaType = TrimmedRange(s, open + 1, close);
+            position = close + 1;
+        }
+    }
+
+    while (position < end && IsBlank(s[position]))
+        ++position;
+
+    result.hasRemainder = (TrimmedRange(s, position, end).length != 0);
+}
+
+static bool IsSymbolIdentifierCharacter(char c)
+{
+    return !IsSymbolBracket(c);
+}
+
+static bool IsStatusCodeCharacter(char c)
+{
+    return IsBlank(c) || IsDigit(c);
+}
+
+/**
+ *  \brief Check `model` keyword ending at position
+ *
+ *  The keyword is either at the beginning of the signature or
+ *  separated by blanks from a model name.
+ */
+static bool ParseModelKeyword(const mdp::ByteBuffer& s,
+                              size_t begin,
+                              size_t position,
+                              ClassifiedPayloadSignature& result)
+{
+    static const size_t KeywordLength = 5;
+
+    while (position > begin && IsBlank(s[position - 1]))
+        --position;
+
+    if (position < begin + KeywordLength ||
+        !IsKeywordAt(s, position - KeywordLength, position, "model", KeywordLength))
+        return false;
+
+    size_t keyword = position - KeywordLength;
+
+    if (keyword == begin) {
+        result.identifier = mdp::BytesRange(begin, 0);
+        return true;
+    }
+
+    if (!IsBlank(s[keyword - 1]))
+        return false;
+
+    for (size_t i = begin; i < keyword; ++i) {
+        if (IsSymbolBracket(s[i]))
+            return false;
+    }
+
+    result.identifier = TrimmedRange(s, begin, keyword);
+    return true;
+}
+
+/** Parse `[<name>] model [(<media type>)]` spanning the whole signature */
+static bool ParseModel(const mdp::ByteBuffer& s, size_t begin, size_t end, ClassifiedPayloadSignature& result)
+{
+    if (begin == end)
+        return false;
+
+    if (s[end - 1] != ')')
+        return ParseModelKeyword(s, begin, end, result);
+
+    // Try every bracket possibly opening the media type
+    for (size_t open = end - 1; open > begin; --open) {
+
+        char c = s[open - 1];
+
+        if (c == ')' || c == '\\')
+            break;
+
+        if (c == '(' && ParseModelKeyword(s, begin, open - 1, result)) {
+            result.mediaType = TrimmedRange(s, open, end - 1);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/** Classify a payload signature in a single scan */
+static ClassifiedPayloadSignature Classify(const mdp::ByteBuffer& text)
+{
+    ClassifiedPayloadSignature result;
+
+    size_t lineEnd = text.find('\n');
+
+    if (lineEnd == mdp::ByteBuffer::npos)
+        lineEnd = text.length();
+
+    mdp::BytesRange line = TrimmedRange(text, 0, lineEnd);
+    size_t begin = line.location;
+    size_t end = line.location + line.length;
+
+    if (IsKeywordAt(text, begin, end, "request", 7)) {
+        result.signature = RequestPayloadSignature;
+        ParseKeywordTail(text, begin + 7, end, IsSymbolIdentifierCharacter, result);
+    }
+    else if (IsKeywordAt(text, begin, end, "response", 8)) {
+        result.signature = ResponsePayloadSignature;
+        ParseKeywordTail(text, begin + 8, end, IsStatusCodeCharacter, result);
+    }
+    else if (ParseModel(text, begin, end, result)) {
+        result.signature = ModelPayloadSignature;
+    }
+    else if (IsKeywordAt(text, begin, end, "sample", 6)) {
+        result.signature = SamplePayloadSignature;
+        ParseKeywordTail(text, begin + 6, end, IsSymbolIdentifierCharacter, result);
+    }
+
+    return result;
+}
+
+ClassifiedPayloadSignature snowcrash::ClassifyPayloadSignature(const mdp::ByteBuffer& text)
+{
+    PayloadSignatureCache* cache = PayloadSignatureCache::active();
+
+    if (!cache)
+        return Classify(text);
+
+    if (cache->text != &text) {
+        cache->classified = Classify(text);
+        cache->text = &text;
+    }
+
+    return cache->classified;
+}
@@ -0,0 +1,113 @@
+//
+//  PayloadSignature.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_PAYLOADSIGNATURE_H
+#define SNOWCRASH_PAYLOADSIGNATURE_H
+
+#include "ByteBuffer.h"
+
+namespace snowcrash {
+
+    /// Payload signature
+    enum PayloadSignature {
+        NoPayloadSignature = 0,
+        RequestPayloadSignature,    /// < Request payload.
+        ResponsePayloadSignature,   /// < Response payload.
+        ModelPayloadSignature,      /// < Resource Model payload.
+        SamplePayloadSignature,     /// < Data Structure Sample payload.
+        UndefinedPayloadSignature = -1
+    };
+
+    /**
+     *  \brief Payload signature classified in a single scan
+     *
+     *  Ranges point into the text the signature has been classified from.
+     */
+    struct ClassifiedPayloadSignature {
+
+        ClassifiedPayloadSignature()
+        : signature(NoPayloadSignature), hasRemainder(false) {}
+
+        /** Kind of the payload */
+        PayloadSignature signature;
+
+        /** Request or sample identifier, response status code or model name, trimmed */
+        mdp::BytesRange identifier;
+
+        /** Media type in brackets, trimmed */
+        mdp::BytesRange mediaType;
+
+        /** True if there is text left after the signature */
+        bool hasRemainder;
+    };
+
+    /**
+     *  \brief Classify a payload signature
+     *
+     *  `request [<identifier>] [(<media type>)]`
+     *  `response [<HTTP status code>] [(<media type>)]`
+     *  `[<name>] model [(<media type>)]`
+     *  `sample [<identifier>] [(<media type>)]`
+     *
+     *  \param text     Text of a list item, only its first line is examined
+     *  \return Classified signature, `NoPayloadSignature` if not a payload
+     */
+    ClassifiedPayloadSignature ClassifyPayloadSignature(const mdp::ByteBuffer& text);
+
+    /**
+     *  \brief Last payload signature classified during a parse
+     *
+     *  Section recognition classifies the signature of a list item and the
+     *  payload processor needs the same classification right after. While
+     *  a cache is active on the current thread, `ClassifyPayloadSignature()`
+     *  keeps its last result with the text it was made from, and returns it
+     *  for the same text without another scan. Texts are told apart by their
+     *  address, the Markdown AST must not change while the cache is active.
+     */
+    struct PayloadSignatureCache {
+
+        PayloadSignatureCache()
+        : text(NULL) {}
+
+        /** Text of the last classification, NULL if none */
+        const mdp::ByteBuffer* text;
+
+        /** Last classification */
+        ClassifiedPayloadSignature classified;
+
+        /** \returns Cache active on the current thread, NULL if none */
+        static PayloadSignatureCache* active();
+
+        /** Set cache active on the current thread */
+        static void setActive(PayloadSignatureCache* cache);
+    };
+
+    /**
+     *  \brief Use a payload signature cache on the current thread for the lifetime of the scope
+     */
+    struct ActivePayloadSignatureCache {
+
+        ActivePayloadSignatureCache(PayloadSignatureCache& cache)
+        : m_previous(PayloadSignatureCache::active()) {
+
+            PayloadSignatureCache::setActive(&cache);
+        }
+
+        ~ActivePayloadSignatureCache() {
+            PayloadSignatureCache::setActive(m_previous);
+        }
+
+    private:
+        PayloadSignatureCache* m_previous;
+
+        ActivePayloadSignatureCache(const ActivePayloadSignatureCache&);
+        ActivePayloadSignatureCache& operator=(const ActivePayloadSignatureCache&);
+    };
+}
+
+#endif
@@ -30,6 +30,12 @@
 #   endif
 #endif
 
+#if defined(_MSC_VER)
+#   define SC_THREAD_LOCAL __declspec(thread)
+#else
+#   define SC_THREAD_LOCAL __thread
+#endif
+
 #ifndef SC_API
 #  ifdef _WIN32
 #     if defined(CSNOWCRASH_BUILD_SHARED) /* build dll */
@@ -27,6 +27,64 @@ namespace snowcrash {
     // Performs posix-regex
     // returns true if target string matches given expression, false otherwise
     bool RegexCapture(const std::string& target, const std::string& expression, CaptureGroups& captureGroups, size_t groupSize = 8);
+
+    /**
+     *  \brief Compiled regular expressions kept between evaluations
+     *
+     *  While a cache is active on a thread, the evaluations above compile
+     *  every expression once and keep it in the cache. Without an active
+     *  cache every evaluation compiles its expression. A cache belongs
+     *  to one parse or one `Parser` and is not shared between threads.
+     */
+    class RegexCache {
+    public:
+        RegexCache();
+        ~RegexCache();
+
+        /** Drop all compiled expressions */
+        void clear();
+
+        /** \returns Cache active on the current thread, NULL if none */
+        static RegexCache* active();
+
+        /** Set cache active on the current thread */
+        static void setActive(RegexCache* cache);
+
+        /** Compiled expressions, defined by the platform implementation */
+        struct Expressions;
+
+        Expressions& expressions() {
+            return *m_expressions;
+        }
+
+    private:
+        Expressions* m_expressions;
+
+        RegexCache(const RegexCache&);
+        RegexCache& operator=(const RegexCache&);
+    };
+
+    /**
+     *  \brief Use a regex cache on the current thread for the lifetime of the scope
+     */
+    struct ActiveRegexCache {
+
+        ActiveRegexCache(RegexCache& cache)
+        : m_previous(RegexCache::active()) {
+
+            RegexCache::setActive(&cache);
+        }
+
+        ~ActiveRegexCache() {
+            RegexCache::setActive(m_previous);
+        }
+
+    private:
+        RegexCache* m_previous;
+
+        ActiveRegexCache(const ActiveRegexCache&);
+        ActiveRegexCache& operator=(const ActiveRegexCache&);
+    };
 }
 
 #endif
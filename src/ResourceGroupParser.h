@@ -11,12 +11,11 @@
 
 #include "SectionParser.h"
 #include "ResourceParser.h"
+#include "HeaderSignature.h"
 #include "RegexMatch.h"
 
 namespace snowcrash {
 
-    const char* const GroupHeaderRegex = "^[[:blank:]]*[Gg]roup[[:blank:]]+" SYMBOL_IDENTIFIER "[[:blank:]]*$";
-
     /** Internal type alias for Collection iterator of Resource */
     typedef Collection<ResourceGroup>::const_iterator ResourceGroupIterator;
 
@@ -26,8 +25,8 @@ namespace snowcrash {
     /**
      * ResourceGroup Section processor
      */
-    template<>
-    struct SectionProcessor<ResourceGroup> : public SectionProcessorBase<ResourceGroup> {
+    template<typename SourceMapPolicy>
+    struct SectionProcessor<ResourceGroup, SourceMapPolicy> : public SectionProcessorBase<ResourceGroup, SourceMapPolicy> {
 
         static MarkdownNodeIterator processSignature(const MarkdownNodeIterator& node,
                                                      const MarkdownNodes& siblings,
@@ -41,20 +40,26 @@ namespace snowcrash {
             // Resources only, parse as exclusive nested sections
             if (nestedType != UndefinedSectionType) {
                 layout = ExclusiveNestedSectionLayout;
+
+                if (pd.events)
+                    pd.events->resourceGroupStart(out.node);
+
                 return cur;
             }
 
-            CaptureGroups captureGroups;
+            HeaderSignature signature;
 
-            if (RegexCapture(node->text, GroupHeaderRegex, captureGroups, 3)) {
-                out.node.name = captureGroups[1];
-                TrimString(out.node.name);
+            if (ScanGroupHeader(node->text, signature)) {
+                out.node.name = HeaderSignature::part(node->text, signature.name);
             }
 
-            if (pd.exportSourceMap() && !out.node.name.empty()) {
+            if (SourceMapPolicy::exportSourceMap(pd) && !out.node.name.empty()) {
                 out.sourceMap.name.sourceMap = node->sourceMap;
             }
 
+            if (pd.events)
+                pd.events->resourceGroupStart(out.node);
+
             return ++MarkdownNodeIterator(node);
         }
 
@@ -67,9 +72,9 @@ namespace snowcrash {
 
                 IntermediateParseResult<Resource> resource(out.report);
 
-                MarkdownNodeIterator cur = ResourceParser::parse(node, siblings, pd, resource);
+                MarkdownNodeIterator cur = SectionParser<Resource, HeaderSectionAdapter, SourceMapPolicy>::parse(node, siblings, pd, resource);
 
-                ResourceIterator duplicate = SectionProcessor<Resource>::findResource(out.node.resources, resource.node);
+                ResourceIterator duplicate = SectionProcessor<Resource, SourceMapPolicy>::findResource(out.node.resources, resource.node);
                 ResourceIteratorPair globalDuplicate;
 
                 if (duplicate == out.node.resources.end()) {
@@ -86,9 +91,12 @@ namespace snowcrash {
                                                           sourceMap));
                 }
 
-                out.node.resources.push_back(resource.node);
+                if (pd.events)
+                    appendResourceSummary(out.node.resources, resource.node);
+                else
+                    out.node.resources.push_back(resource.node);
 
-                if (pd.exportSourceMap()) {
+                if (SourceMapPolicy::exportSourceMap(pd)) {
                     out.sourceMap.resources.collection.push_back(resource.sourceMap);
                 }
 
@@ -104,13 +112,13 @@ namespace snowcrash {
                                                           SectionType& lastSectionType,
                                                           const ParseResultRef<ResourceGroup>& out) {
 
-            if (SectionProcessor<Action>::actionType(node) == DependentActionType &&
+            if (SectionProcessor<Action, SourceMapPolicy>::actionType(node) == DependentActionType &&
                 !out.node.resources.empty()) {
 
                 mdp::ByteBuffer method;
                 mdp::ByteBuffer name;
 
-                SectionProcessor<Action>::actionHTTPMethodAndName(node, method, name);
+                SectionProcessor<Action, SourceMapPolicy>::actionHTTPMethodAndName(node, method, name);
                 mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceData);
 
                 // WARN: Unexpected action
@@ -125,7 +133,15 @@ namespace snowcrash {
                 return ++MarkdownNodeIterator(node);
             }
 
-            return SectionProcessorBase<ResourceGroup>::processUnexpectedNode(node, siblings, pd, lastSectionType, out);
+            return SectionProcessorBase<ResourceGroup, SourceMapPolicy>::processUnexpectedNode(node, siblings, pd, lastSectionType, out);
+        }
+
+        static void finalize(const MarkdownNodeIterator& node,
+                             SectionParserData& pd,
+                             const ParseResultRef<ResourceGroup>& out) {
+
+            if (pd.events)
+                pd.events->resourceGroupEnd(out.node);
         }
 
         static SectionType sectionType(const MarkdownNodeIterator& node) {
@@ -133,10 +149,11 @@ namespace snowcrash {
             if (node->type == mdp::HeaderMarkdownNodeType
                 && !node->text.empty()) {
 
+                HeaderSignature signature;
                 mdp::ByteBuffer subject = node->text;
                 TrimString(subject);
 
-                if (RegexMatch(subject, GroupHeaderRegex)) {
+                if (ScanGroupHeader(subject, signature)) {
                     return ResourceGroupSectionType;
                 }
             }
@@ -147,7 +164,7 @@ namespace snowcrash {
         static SectionType nestedSectionType(const MarkdownNodeIterator& node) {
 
             // Return ResourceSectionType or UndefinedSectionType
-            return SectionProcessor<Resource>::sectionType(node);
+            return SectionProcessor<Resource, SourceMapPolicy>::sectionType(node);
         }
 
         static SectionTypes nestedSectionTypes() {
@@ -155,7 +172,7 @@ namespace snowcrash {
 
             // Resource & descendants
             nested.push_back(ResourceSectionType);
-            SectionTypes types = SectionProcessor<Resource>::nestedSectionTypes();
+            SectionTypes types = SectionProcessor<Resource, SourceMapPolicy>::nestedSectionTypes();
             nested.insert(nested.end(), types.begin(), types.end());
 
             return nested;
@@ -166,24 +183,77 @@ namespace snowcrash {
 
             mdp::ByteBuffer method;
 
-            if (SectionProcessor<Action>::actionType(node) == CompleteActionType) {
+            if (SectionProcessor<Action, SourceMapPolicy>::actionType(node) == CompleteActionType) {
                 return false;
             }
 
-            return SectionProcessorBase<ResourceGroup>::isDescriptionNode(node, sectionType);
+            return SectionProcessorBase<ResourceGroup, SourceMapPolicy>::isDescriptionNode(node, sectionType);
         }
 
         static bool isUnexpectedNode(const MarkdownNodeIterator& node,
                                      SectionType sectionType) {
 
-            if (SectionProcessor<Action>::actionType(node) == DependentActionType) {
+            if (SectionProcessor<Action, SourceMapPolicy>::actionType(node) == DependentActionType) {
                 return true;
             }
 
-            return SectionProcessorBase<ResourceGroup>::isUnexpectedNode(node, sectionType);
+            return SectionProcessorBase<ResourceGroup, SourceMapPolicy>::isUnexpectedNode(node, sectionType);
         }
 
         /** Finds a resource in blueprint by its URI template */
+        /**
+         *  \brief Append the summary of a resource reported as events
+         *
+         *  Keeps the URI template and name for the duplicate checks, and the
+         *  payloads with pending references to resolve them at the end of
+         *  the blueprint.
+         */
+        static void appendResourceSummary(Resources& resources,
+                                          const Resource& resource) {
+
+            resources.push_back(Resource());
+
+            Resource& summary = resources.back();
+            summary.uriTemplate = resource.uriTemplate;
+            summary.name = resource.name;
+
+            for (Actions::const_iterator actionIt = resource.actions.begin();
+                 actionIt != resource.actions.end();
+                 ++actionIt) {
+
+                Action action;
+
+                for (TransactionExamples::const_iterator exampleIt = actionIt->examples.begin();
+                     exampleIt != actionIt->examples.end();
+                     ++exampleIt) {
+
+                    TransactionExample example;
+
+                    for (Requests::const_iterator requestIt = exampleIt->requests.begin();
+                         requestIt != exampleIt->requests.end();
+                         ++requestIt) {
+
+                        if (requestIt->reference.meta.state == Reference::StatePending)
+                            example.requests.push_back(*requestIt);
+                    }
+
+                    for (Responses::const_iterator responseIt = exampleIt->responses.begin();
+                         responseIt != exampleIt->responses.end();
+                         ++responseIt) {
+
+                        if (responseIt->reference.meta.state == Reference::StatePending)
+                            example.responses.push_back(*responseIt);
+                    }
+
+                    if (!example.requests.empty() || !example.responses.empty())
+                        action.examples.push_back(example);
+                }
+
+                if (!action.examples.empty())
+                    summary.actions.push_back(action);
+            }
+        }
+
         static ResourceIteratorPair findResource(const Blueprint& blueprint,
                                                  const Resource& resource) {
 
@@ -191,7 +261,7 @@ namespace snowcrash {
                   it != blueprint.resourceGroups.end();
                   ++it) {
 
-                ResourceIterator match = SectionProcessor<Resource>::findResource(it->resources, resource);
+                ResourceIterator match = SectionProcessor<Resource, SourceMapPolicy>::findResource(it->resources, resource);
 
                 if (match != it->resources.end()) {
                     return std::make_pair(it, match);
@@ -14,24 +14,19 @@
 #include "HeadersParser.h"
 #include "ParametersParser.h"
 #include "UriTemplateParser.h"
+#include "HeaderSignature.h"
 #include "RegexMatch.h"
 
 namespace snowcrash {
 
-    /** Nameless resource matching regex */
-    const char* const ResourceHeaderRegex = "^[[:blank:]]*(" HTTP_REQUEST_METHOD "[[:blank:]]+)?" URI_TEMPLATE "$";
-
-    /** Named resource matching regex */
-    const char* const NamedResourceHeaderRegex = "^[[:blank:]]*" SYMBOL_IDENTIFIER "[[:blank:]]+\\[" URI_TEMPLATE "]$";
-
     /** Internal type alias for Collection iterator of Resource */
     typedef Collection<Resource>::const_iterator ResourceIterator;
 
     /**
      * Resource Section processor
      */
-    template<>
-    struct SectionProcessor<Resource> : public SectionProcessorBase<Resource> {
+    template<typename SourceMapPolicy>
+    struct SectionProcessor<Resource, SourceMapPolicy> : public SectionProcessorBase<Resource, SourceMapPolicy> {
 
         static MarkdownNodeIterator processSignature(const MarkdownNodeIterator& node,
                                                      const MarkdownNodes& siblings,
@@ -39,38 +34,40 @@ namespace snowcrash {
                                                      SectionLayout& layout,
                                                      const ParseResultRef<Resource>& out) {
 
-            CaptureGroups captureGroups;
+            HeaderSignature signature;
 
             // If Abbreviated resource section
-            if (RegexCapture(node->text, ResourceHeaderRegex, captureGroups, 4)) {
+            if (ScanResourceHeader(node->text, signature)) {
 
-                out.node.uriTemplate = captureGroups[3];
+                out.node.uriTemplate = HeaderSignature::part(node->text, signature.uriTemplate);
 
                 // Make this section an action
-                if (!captureGroups[2].empty()) {
+                if (signature.method.length != 0) {
+
+                    if (pd.events)
+                        pd.events->resourceStart(out.node);
 
                     IntermediateParseResult<Action> action(out.report);
 
-                    MarkdownNodeIterator cur = ActionParser::parse(node, node->parent().children(), pd, action);
+                    MarkdownNodeIterator cur = SectionParser<Action, HeaderSectionAdapter, SourceMapPolicy>::parse(node, node->parent().children(), pd, action);
 
                     out.node.actions.push_back(action.node);
                     layout = RedirectSectionLayout;
 
-                    if (pd.exportSourceMap()) {
+                    if (SourceMapPolicy::exportSourceMap(pd)) {
                         out.sourceMap.actions.collection.push_back(action.sourceMap);
                         out.sourceMap.uriTemplate.sourceMap = node->sourceMap;
                     }
 
                     return cur;
                 }
-            } else if (RegexCapture(node->text, NamedResourceHeaderRegex, captureGroups, 4)) {
+            } else if (ScanNamedResourceHeader(node->text, signature)) {
 
-                out.node.name = captureGroups[1];
-                TrimString(out.node.name);
-                out.node.uriTemplate = captureGroups[2];
+                out.node.name = HeaderSignature::part(node->text, signature.name);
+                out.node.uriTemplate = HeaderSignature::part(node->text, signature.uriTemplate);
             }
 
-            if (pd.exportSourceMap()) {
+            if (SourceMapPolicy::exportSourceMap(pd)) {
                 if (!out.node.uriTemplate.empty()) {
                     out.sourceMap.uriTemplate.sourceMap = node->sourceMap;
                 }
@@ -80,6 +77,9 @@ namespace snowcrash {
                 }
             }
 
+            if (pd.events)
+                pd.events->resourceStart(out.node);
+
             return ++MarkdownNodeIterator(node);
         }
 
@@ -98,7 +98,7 @@ namespace snowcrash {
                 case AttributesSectionType:
                 {
                     ParseResultRef<Parameters> parameters(out.report, out.node.attributes, out.sourceMap.attributes);
-                    return ParametersParser::parse(node, siblings, pd, parameters);
+                    return SectionParser<Parameters, ListSectionAdapter, SourceMapPolicy>::parse(node, siblings, pd, parameters);
                 }
 
                 case ModelSectionType:
@@ -108,7 +108,7 @@ namespace snowcrash {
                 case HeadersSectionType:
                 {
                     ParseResultRef<Headers> headers(out.report, out.node.headers, out.sourceMap.headers);
-                    return SectionProcessor<Action>::handleDeprecatedHeaders(node, siblings, pd, headers);
+                    return SectionProcessor<Action, SourceMapPolicy>::handleDeprecatedHeaders(node, siblings, pd, headers);
                 }
 
                 default:
@@ -129,9 +129,10 @@ namespace snowcrash {
                 (sectionType == ModelBodySectionType ||
                  sectionType == ModelSectionType)) {
 
-                mdp::ByteBuffer content = CodeBlockUtility::addDanglingAsset(node, pd, sectionType, out.report, out.node.model.body);
+                bool skip = pd.skip(SkipBodiesOption);
+                bool added = CodeBlockUtility::addDanglingAsset(node, pd, sectionType, out.report, skip ? NULL : &out.node.model.body);
 
-                if (pd.exportSourceMap() && !content.empty()) {
+                if ((SourceMapPolicy::exportSourceMap(pd) || skip) && added) {
                     out.sourceMap.model.body.sourceMap.append(node->sourceMap);
                 }
 
@@ -141,7 +142,7 @@ namespace snowcrash {
                 if (it != pd.symbolTable.resourceModels.end()) {
                     it->second.body = out.node.model.body;
 
-                    if (pd.exportSourceMap()) {
+                    if (SourceMapPolicy::exportSourceMap(pd) || skip) {
                         pd.symbolSourceMapTable.resourceModels[out.node.model.name].body = out.sourceMap.model.body;
                     }
                 }
@@ -149,17 +150,17 @@ namespace snowcrash {
                 return ++MarkdownNodeIterator(node);
             }
 
-            return SectionProcessorBase<Resource>::processUnexpectedNode(node, siblings, pd, sectionType, out);
+            return SectionProcessorBase<Resource, SourceMapPolicy>::processUnexpectedNode(node, siblings, pd, sectionType, out);
         }
 
         static bool isDescriptionNode(const MarkdownNodeIterator& node,
                                       SectionType sectionType) {
 
-            if (SectionProcessor<Action>::actionType(node) == CompleteActionType) {
+            if (SectionProcessor<Action, SourceMapPolicy>::actionType(node) == CompleteActionType) {
                 return false;
             }
 
-            return SectionProcessorBase<Resource>::isDescriptionNode(node, sectionType);
+            return SectionProcessorBase<Resource, SourceMapPolicy>::isDescriptionNode(node, sectionType);
         }
 
         static SectionType sectionType(const MarkdownNodeIterator& node) {
@@ -167,13 +168,13 @@ namespace snowcrash {
             if (node->type == mdp::HeaderMarkdownNodeType
                 && !node->text.empty()) {
 
-                CaptureGroups captureGroups;
+                HeaderSignature signature;
                 mdp::ByteBuffer subject = node->text;
 
                 TrimString(subject);
 
-                if (RegexMatch(subject, NamedResourceHeaderRegex) ||
-                    RegexMatch(subject, ResourceHeaderRegex)) {
+                if (ScanNamedResourceHeader(subject, signature) ||
+                    ScanResourceHeader(subject, signature)) {
                     return ResourceSectionType;
                 }
             }
@@ -186,21 +187,21 @@ namespace snowcrash {
             SectionType nestedType = UndefinedSectionType;
 
             // Check if parameters section
-            nestedType = SectionProcessor<Parameters>::sectionType(node);
+            nestedType = SectionProcessor<Parameters, SourceMapPolicy>::sectionType(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if headers section
-            nestedType = SectionProcessor<Headers>::sectionType(node);
+            nestedType = SectionProcessor<Headers, SourceMapPolicy>::sectionType(node);
 
             if (nestedType == HeadersSectionType) {
                 return nestedType;
             }
 
             // Check if model section
-            nestedType = SectionProcessor<Payload>::sectionType(node);
+            nestedType = SectionProcessor<Payload, SourceMapPolicy>::sectionType(node);
 
             if (nestedType == ModelSectionType ||
                 nestedType == ModelBodySectionType) {
@@ -209,13 +210,13 @@ namespace snowcrash {
             }
 
             // Check if action section
-            nestedType = SectionProcessor<Action>::sectionType(node);
+            nestedType = SectionProcessor<Action, SourceMapPolicy>::sectionType(node);
 
             if (nestedType == ActionSectionType) {
 
                 // Do not consider complete actions as nested
                 mdp::ByteBuffer method;
-                if (SectionProcessor<Action>::actionType(node) == CompleteActionType)
+                if (SectionProcessor<Action, SourceMapPolicy>::actionType(node) == CompleteActionType)
                     return UndefinedSectionType;
 
                 return nestedType;
@@ -229,7 +230,7 @@ namespace snowcrash {
 
             // Action & descendants
             nested.push_back(ActionSectionType);
-            SectionTypes types = SectionProcessor<Action>::nestedSectionTypes();
+            SectionTypes types = SectionProcessor<Action, SourceMapPolicy>::nestedSectionTypes();
             nested.insert(nested.end(), types.begin(), types.end());
 
             nested.push_back(ModelSectionType);
@@ -265,15 +266,18 @@ namespace snowcrash {
                      actIt != out.node.actions.end();
                      ++actIt, ++actSMIt) {
 
-                    SectionProcessor<Headers>::injectDeprecatedHeaders(pd, out.node.headers, out.sourceMap.headers, actIt->examples, actSMIt->examples);
+                    SectionProcessor<Headers, SourceMapPolicy>::injectDeprecatedHeaders(pd, out.node.headers, out.sourceMap.headers, actIt->examples, actSMIt->examples);
                 }
 
                 out.node.headers.clear();
 
-                if (pd.exportSourceMap()) {
+                if (SourceMapPolicy::exportSourceMap(pd)) {
                     out.sourceMap.headers.collection.clear();
                 }
             }
+
+            if (pd.events)
+                pd.events->resourceEnd(out.node);
         }
 
         /** Process Action section */
@@ -284,9 +288,9 @@ namespace snowcrash {
 
             IntermediateParseResult<Action> action(out.report);
 
-            MarkdownNodeIterator cur = ActionParser::parse(node, siblings, pd, action);
+            MarkdownNodeIterator cur = SectionParser<Action, HeaderSectionAdapter, SourceMapPolicy>::parse(node, siblings, pd, action);
 
-            ActionIterator duplicate = SectionProcessor<Action>::findAction(out.node.actions, action.node);
+            ActionIterator duplicate = SectionProcessor<Action, SourceMapPolicy>::findAction(out.node.actions, action.node);
 
             if (duplicate != out.node.actions.end()) {
 
@@ -304,11 +308,17 @@ namespace snowcrash {
             if (!action.node.parameters.empty()) {
 
                 checkParametersEligibility(node, pd, action.node.parameters, out);
+
+                // Skipped parameters are dropped once checked, before the action is added
+                if (pd.skip(SkipParametersOption)) {
+                    action.node.parameters.clear();
+                    action.sourceMap.parameters.collection.clear();
+                }
             }
 
             out.node.actions.push_back(action.node);
 
-            if (pd.exportSourceMap()) {
+            if (SourceMapPolicy::exportSourceMap(pd)) {
                 out.sourceMap.actions.collection.push_back(action.sourceMap);
             }
 
@@ -323,14 +333,18 @@ namespace snowcrash {
 
             IntermediateParseResult<Parameters> parameters(out.report);
 
-            MarkdownNodeIterator cur = ParametersParser::parse(node, siblings, pd, parameters);
+            MarkdownNodeIterator cur = SectionParser<Parameters, ListSectionAdapter, SourceMapPolicy>::parse(node, siblings, pd, parameters);
 
             if (!parameters.node.empty()) {
 
                 checkParametersEligibility(node, pd, parameters.node, out);
+
+                if (pd.skip(SkipParametersOption))
+                    return cur;
+
                 out.node.parameters.insert(out.node.parameters.end(), parameters.node.begin(), parameters.node.end());
 
-                if (pd.exportSourceMap()) {
+                if (SourceMapPolicy::exportSourceMap(pd)) {
                     out.sourceMap.parameters.collection.insert(out.sourceMap.parameters.collection.end(),
                                                                parameters.sourceMap.collection.begin(),
                                                                parameters.sourceMap.collection.end());
@@ -348,7 +362,7 @@ namespace snowcrash {
 
             IntermediateParseResult<Payload> model(out.report);
 
-            MarkdownNodeIterator cur = PayloadParser::parse(node, siblings, pd, model);
+            MarkdownNodeIterator cur = SectionParser<Payload, ListSectionAdapter, SourceMapPolicy>::parse(node, siblings, pd, model);
 
             // Check whether there isn't a model already
             if (!out.node.model.name.empty()) {
@@ -376,7 +390,7 @@ namespace snowcrash {
                 if (!out.node.name.empty()) {
                     model.node.name = out.node.name;
 
-                    if (pd.exportSourceMap()) {
+                    if (SourceMapPolicy::exportSourceMap(pd)) {
                         model.sourceMap.name = out.sourceMap.name;
                     }
                 } else {
@@ -393,13 +407,21 @@ namespace snowcrash {
                 }
             }
 
+            if (pd.skip(SkipParametersOption)) {
+                model.node.parameters.clear();
+                model.sourceMap.parameters.collection.clear();
+            }
+
+            // Skipped bodies are told by the model source map, see PayloadParser hasBody()
+            bool trackBody = SourceMapPolicy::exportSourceMap(pd) || pd.skip(SkipBodiesOption);
+
             ResourceModelSymbolTable::iterator it = pd.symbolTable.resourceModels.find(model.node.name);
 
             if (it == pd.symbolTable.resourceModels.end()) {
 
                 pd.symbolTable.resourceModels[model.node.name] = model.node;
 
-                if (pd.exportSourceMap()) {
+                if (trackBody) {
                     pd.symbolSourceMapTable.resourceModels[model.node.name] = model.sourceMap;
                 }
             } else {
@@ -416,7 +438,7 @@ namespace snowcrash {
 
             out.node.model = model.node;
 
-            if (pd.exportSourceMap()) {
+            if (trackBody) {
                 out.sourceMap.model = model.sourceMap;
             }
 
@@ -0,0 +1,585 @@
+//
+//  RouteIndex.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <map>
+#include "RouteIndex.h"
+#include "UriTemplateParser.h"
+
+using namespace snowcrash;
+
+/** Names of the variables of one template expression */
+typedef std::vector<std::string> ExpressionNames;
+
+/**
+ *  \brief Compiled path segment
+ *
+ *  Literal parts with an expression between every two of them,
+ *  `{id}.json` compiles into literals `""` and `".json"`.
+ */
+struct SegmentPattern {
+
+    /** Literal parts, one more than expressions */
+    std::vector<std::string> literals;
+
+    /** Variable names of every expression */
+    std::vector<ExpressionNames> names;
+
+    /** True if the last expression is a reserved expansion matching the rest of the path */
+    bool catchAll;
+
+    SegmentPattern() : catchAll(false) {
+        literals.push_back(std::string());
+    }
+
+    /** \returns Number of expressions */
+    size_t expressions() const {
+        return names.size();
+    }
+
+    /** \returns Key identifying patterns matching the same input */
+    std::string key() const {
+
+        std::string result = literals.front();
+
+        for (size_t i = 1; i < literals.size(); ++i) {
+            result += (catchAll && i == literals.size() - 1) ? "{+}" : "{}";
+            result += literals[i];
+        }
+
+        return result;
+    }
+};
+
+typedef std::vector<SegmentPattern> SegmentPatterns;
+
+/** Indexed Action */
+struct Route {
+
+    const ResourceGroup* resourceGroup;
+    const Resource* resource;
+    const Action* action;
+
+    /** Names of path expressions in order of captures */
+    std::vector<ExpressionNames> pathNames;
+
+    /** Names of query expressions */
+    ExpressionNames queryNames;
+};
+
+struct RouteIndex::Node {
+
+    /** Edges of segments with no expression */
+    typedef std::map<std::string, Node*> LiteralEdges;
+    LiteralEdges literals;
+
+    /** Edges of segments mixing literals and expressions */
+    typedef std::vector<std::pair<SegmentPattern, Node*> > PatternEdges;
+    PatternEdges patterns;
+
+    /** Edge of a segment made of a single expression */
+    Node* variable;
+
+    /** Edges matching the rest of the path */
+    PatternEdges catchAlls;
+
+    /** Routes ending in this node by method */
+    typedef std::map<HTTPMethod, Route> Routes;
+    Routes routes;
+
+    Node() : variable(NULL) {}
+
+    ~Node() {
+
+        for (LiteralEdges::iterator it = literals.begin(); it != literals.end(); ++it)
+            delete it->second;
+
+        for (PatternEdges::iterator it = patterns.begin(); it != patterns.end(); ++it)
+            delete it->second;
+
+        for (PatternEdges::iterator it = catchAlls.begin(); it != catchAlls.end(); ++it)
+            delete it->second;
+
+        delete variable;
+    }
+
+    /** \returns Child for a segment pattern, creating it if needed */
+    Node* child(const SegmentPattern& pattern) {
+
+        if (pattern.expressions() == 0) {
+
+            Node*& node = literals[pattern.literals.front()];
+            if (!node)
+                node = new Node;
+            return node;
+        }
+
+        if (!pattern.catchAll &&
+            pattern.expressions() == 1 &&
+            pattern.literals.front().empty() &&
+            pattern.literals.back().empty()) {
+
+            if (!variable)
+                variable = new Node;
+            return variable;
+        }
+
+        PatternEdges& edges = pattern.catchAll ? catchAlls : patterns;
+        std::string key = pattern.key();
+
+        for (PatternEdges::iterator it = edges.begin(); it != edges.end(); ++it) {
+            if (it->first.key() == key)
+                return it->second;
+        }
+
+        edges.push_back(std::make_pair(pattern, new Node));
+        return edges.back().second;
+    }
+};
+
+/** \returns Variable names of an expression without the operator and modifiers */
+static ExpressionNames GetExpressionNames(const Expression& expression)
+{
+    ExpressionNames names;
+    size_t start = (!expression.empty() && std::string("+#?&").find(expression[0]) != std::string::npos) ? 1 : 0;
+
+    while (start <= expression.length()) {
+
+        size_t end = expression.find(',', start);
+        if (end == std::string::npos)
+            end = expression.length();
+
+        std::string name = expression.substr(start, end - start);
+
+        // Strip explode and prefix modifiers
+        size_t modifier = name.find_first_of("*:");
+        if (modifier != std::string::npos)
+            name.erase(modifier);
+
+        names.push_back(name);
+        start = end + 1;
+    }
+
+    return names;
+}
+
+/**
+ *  \brief Compile the path of a URI template into segment patterns
+ *  \return False if the template can't be indexed
+ */
+static bool CompileURITemplate(const URITemplate& uriTemplate,
+                               SegmentPatterns& segments,
+                               ExpressionNames& queryNames)
+{
+    ParsedURITemplate parsed;
+    URITemplateParser::parse(uriTemplate, mdp::CharactersRangeSet(), parsed);
+
+    if (parsed.report.error.code != Error::OK)
+        return false;
+
+    const std::string& path = parsed.path;
+    bool reserved = false;
+    bool query = false;
+
+    segments.push_back(SegmentPattern());
+
+    for (size_t i = 0; i < path.length(); ++i) {
+
+        if (path[i] == '}')
+            return false;
+
+        if (path[i] != '{') {
+
+            // Literal query string or fragment ends the path
+            if (query || path[i] == '?' || path[i] == '#')
+                break;
+
+            if (path[i] == '/') {
+                segments.push_back(SegmentPattern());
+                reserved = false;
+            }
+            else {
+                segments.back().literals.back() += path[i];
+            }
+
+            continue;
+        }
+
+        size_t end = path.find_first_of("{}", i + 1);
+
+        if (end == std::string::npos || path[end] != '}')
+            return false;
+
+        Expression expression = path.substr(i + 1, end - i - 1);
+        i = end;
+
+        ClassifiedExpression classified = URITemplateParser::classifyExpression(expression);
+
+        if (!classified.IsSupportedExpressionType())
+            return false;
+
+        char op = expression.empty() ? '\0' : expression[0];
+
+        if (op == '#')
+            break;
+
+        if (op == '?' || op == '&') {
+
+            ExpressionNames names = GetExpressionNames(expression);
+            queryNames.insert(queryNames.end(), names.begin(), names.end());
+            query = true;
+            continue;
+        }
+
+        if (query)
+            return false;
+
+        SegmentPattern& segment = segments.back();
+        segment.names.push_back(GetExpressionNames(expression));
+        segment.literals.push_back(std::string());
+        reserved = (op == '+');
+    }
+
+    // Trailing reserved expansion matches the rest of the path
+    segments.back().catchAll = reserved && segments.back().expressions() > 0;
+
+    return true;
+}
+
+/**
+ *  \brief Match a text against a segment pattern
+ *
+ *  Every expression captures at least one character. Only the last
+ *  expression of a catch-all pattern can capture a slash.
+ */
+static bool MatchPattern(const SegmentPattern& pattern,
+                         const std::string& text,
+                         std::vector<std::string>& captures)
+{
+    const std::string& prefix = pattern.literals.front();
+
+    if (text.compare(0, prefix.length(), prefix) != 0)
+        return false;
+
+    size_t position = prefix.length();
+    size_t count = pattern.expressions();
+
+    for (size_t i = 0; i < count; ++i) {
+
+        const std::string& literal = pattern.literals[i + 1];
+        bool last = (i == count - 1);
+        size_t end;
+
+        if (last) {
+
+            if (text.length() < position + literal.length() + 1)
+                return false;
+
+            end = text.length() - literal.length();
+
+            if (text.compare(end, literal.length(), literal) != 0)
+                return false;
+        }
+        else if (literal.empty()) {
+            end = position + 1;
+        }
+        else {
+            end = text.find(literal, position + 1);
+        }
+
+        if (end == std::string::npos || end <= position || end > text.length())
+            return false;
+
+        std::string capture = text.substr(position, end - position);
+
+        if (!(last && pattern.catchAll) && capture.find('/') != std::string::npos)
+            return false;
+
+        captures.push_back(capture);
+        position = end + literal.length();
+    }
+
+    return count > 0 || position == text.length();
+}
+
+/** Request path split into segments */
+struct RequestPath {
+
+    /** Path without the query string */
+    std::string path;
+
+    /** Start of every segment in the path */
+    std::vector<size_t> starts;
+
+    /** Text of every segment */
+    std::vector<std::string> segments;
+};
+
+static void SplitRequestPath(const std::string& path, RequestPath& request)
+{
+    request.path = path;
+    size_t start = 0;
+
+    while (true) {
+
+        size_t end = path.find('/', start);
+
+        request.starts.push_back(start);
+        request.segments.push_back(path.substr(start, (end == std::string::npos) ? std::string::npos : end - start));
+
+        if (end == std::string::npos)
+            break;
+
+        start = end + 1;
+    }
+}
+
+/** \returns Route for the method reached from a node, NULL if none */
+static const Route* FindRoute(const RouteIndex::Node* node,
+                              const HTTPMethod& method,
+                              const RequestPath& request,
+                              size_t index,
+                              std::vector<std::string>& captures)
+{
+    if (index == request.segments.size()) {
+
+        RouteIndex::Node::Routes::const_iterator it = node->routes.find(method);
+        return (it != node->routes.end()) ? &it->second : NULL;
+    }
+
+    const std::string& segment = request.segments[index];
+    size_t mark = captures.size();
+    const Route* route = NULL;
+
+    // Literal segment
+    RouteIndex::Node::LiteralEdges::const_iterator literal = node->literals.find(segment);
+
+    if (literal != node->literals.end()) {
+
+        route = FindRoute(literal->second, method, request, index + 1, captures);
+        if (route)
+            return route;
+    }
+
+    // Literals mixed with expressions
+    for (RouteIndex::Node::PatternEdges::const_iterator it = node->patterns.begin();
+         it != node->patterns.end();
+         ++it) {
+
+        if (MatchPattern(it->first, segment, captures)) {
+
+            route = FindRoute(it->second, method, request, index + 1, captures);
+            if (route)
+                return route;
+        }
+
+        captures.resize(mark);
+    }
+
+    // Single variable
+    if (node->variable && !segment.empty()) {
+
+        captures.push_back(segment);
+
+        route = FindRoute(node->variable, method, request, index + 1, captures);
+        if (route)
+            return route;
+
+        captures.resize(mark);
+    }
+
+    // Rest of the path
+    if (!node->catchAlls.empty()) {
+
+        std::string rest = request.path.substr(request.starts[index]);
+
+        for (RouteIndex::Node::PatternEdges::const_iterator it = node->catchAlls.begin();
+             it != node->catchAlls.end();
+             ++it) {
+
+            if (MatchPattern(it->first, rest, captures)) {
+
+                route = FindRoute(it->second, method, request, request.segments.size(), captures);
+                if (route)
+                    return route;
+            }
+
+            captures.resize(mark);
+        }
+    }
+
+    return NULL;
+}
+
+/** Add values of comma-separated expression capture to variables */
+static void AddVariables(const ExpressionNames& names, const std::string& capture, RouteVariables& variables)
+{
+    if (names.size() == 1) {
+        variables.push_back(std::make_pair(names.front(), capture));
+        return;
+    }
+
+    size_t start = 0;
+
+    for (ExpressionNames::const_iterator it = names.begin(); it != names.end() && start <= capture.length(); ++it) {
+
+        size_t end = capture.find(',', start);
+        if (end == std::string::npos)
+            end = capture.length();
+
+        variables.push_back(std::make_pair(*it, capture.substr(start, end - start)));
+        start = end + 1;
+    }
+}
+
+/** Add query variables present in a query string */
+static void AddQueryVariables(const ExpressionNames& names, const std::string& query, RouteVariables& variables)
+{
+    for (ExpressionNames::const_iterator name = names.begin(); name != names.end(); ++name) {
+
+        size_t start = 0;
+
+        while (start <= query.length()) {
+
+            size_t end = query.find('&', start);
+            if (end == std::string::npos)
+                end = query.length();
+
+            std::string parameter = query.substr(start, end - start);
+            size_t assignment = parameter.find('=');
+
+            if (parameter.substr(0, assignment) == *name) {
+
+                std::string value = (assignment != std::string::npos) ? parameter.substr(assignment + 1) : std::string();
+                variables.push_back(std::make_pair(*name, value));
+                break;
+            }
+
+            start = end + 1;
+        }
+    }
+}
+
+RouteIndex::RouteIndex()
+: m_root(new Node), m_size(0), m_skipped(0)
+{
+}
+
+RouteIndex::RouteIndex(const Blueprint& blueprint)
+: m_root(new Node), m_size(0), m_skipped(0)
+{
+    build(blueprint);
+}
+
+RouteIndex::~RouteIndex()
+{
+    delete m_root;
+}
+
+void RouteIndex::clear()
+{
+    delete m_root;
+    m_root = new Node;
+    m_size = 0;
+    m_skipped = 0;
+}
+
+void RouteIndex::build(const Blueprint& blueprint)
+{
+    clear();
+
+    for (ResourceGroups::const_iterator group = blueprint.resourceGroups.begin();
+         group != blueprint.resourceGroups.end();
+         ++group) {
+
+        for (Resources::const_iterator resource = group->resources.begin();
+             resource != group->resources.end();
+             ++resource) {
+
+            SegmentPatterns segments;
+            ExpressionNames queryNames;
+
+            if (!CompileURITemplate(resource->uriTemplate, segments, queryNames)) {
+                m_skipped += resource->actions.size();
+                continue;
+            }
+
+            Node* node = m_root;
+            std::vector<ExpressionNames> pathNames;
+
+            for (SegmentPatterns::const_iterator segment = segments.begin(); segment != segments.end(); ++segment) {
+
+                node = node->child(*segment);
+                pathNames.insert(pathNames.end(), segment->names.begin(), segment->names.end());
+            }
+
+            for (Actions::const_iterator action = resource->actions.begin();
+                 action != resource->actions.end();
+                 ++action) {
+
+                if (action->method.empty() || node->routes.find(action->method) != node->routes.end()) {
+                    ++m_skipped;
+                    continue;
+                }
+
+                Route& route = node->routes[action->method];
+                route.resourceGroup = &*group;
+                route.resource = &*resource;
+                route.action = &*action;
+                route.pathNames = pathNames;
+                route.queryNames = queryNames;
+
+                ++m_size;
+            }
+        }
+    }
+}
+
+bool RouteIndex::match(const HTTPMethod& method, const std::string& path, RouteMatch& match) const
+{
+    match = RouteMatch();
+
+    size_t queryStart = path.find_first_of("?#");
+    std::string query;
+
+    if (queryStart != std::string::npos && path[queryStart] == '?') {
+
+        size_t fragment = path.find('#', queryStart);
+        query = path.substr(queryStart + 1, (fragment == std::string::npos) ? std::string::npos : fragment - queryStart - 1);
+    }
+
+    RequestPath request;
+    SplitRequestPath(path.substr(0, queryStart), request);
+
+    std::vector<std::string> captures;
+    const Route* route = FindRoute(m_root, method, request, 0, captures);
+
+    if (!route)
+        return false;
+
+    match.resourceGroup = route->resourceGroup;
+    match.resource = route->resource;
+    match.action = route->action;
+
+    for (size_t i = 0; i < captures.size() && i < route->pathNames.size(); ++i) {
+        AddVariables(route->pathNames[i], captures[i], match.variables);
+    }
+
+    AddQueryVariables(route->queryNames, query, match.variables);
+
+    return true;
+}
+
+size_t RouteIndex::size() const
+{
+    return m_size;
+}
+
+size_t RouteIndex::skipped() const
+{
+    return m_skipped;
+}
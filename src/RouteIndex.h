@@ -0,0 +1,95 @@
+//
+//  RouteIndex.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_ROUTEINDEX_H
+#define SNOWCRASH_ROUTEINDEX_H
+
+#include <string>
+#include "Blueprint.h"
+
+namespace snowcrash {
+
+    /** Template variables extracted from a request, in order of the URI template */
+    typedef Collection<KeyValuePair>::type RouteVariables;
+
+    /**
+     *  \brief Request matched by a RouteIndex
+     *
+     *  Pointers refer into the blueprint the index was built from.
+     */
+    struct RouteMatch {
+
+        RouteMatch() : resourceGroup(NULL), resource(NULL), action(NULL) {}
+
+        /** Resource Group of the matched Resource */
+        const ResourceGroup* resourceGroup;
+
+        /** Matched Resource */
+        const Resource* resource;
+
+        /** Matched Action */
+        const Action* action;
+
+        /** Path and query variables, values are not percent-decoded */
+        RouteVariables variables;
+    };
+
+    /**
+     *  \brief Request routing index
+     *
+     *  A segment trie compiled from the URI templates and methods of
+     *  all Actions in a Blueprint. A request path is resolved by walking
+     *  the trie preferring literal segments over segments mixing literals
+     *  with expressions, over whole-segment variables, over trailing
+     *  reserved expansions (`{+path}`) matching the rest of the path.
+     *
+     *  Templates with expressions unsupported by URITemplateParser are
+     *  not indexed. The index holds pointers into the Blueprint, which
+     *  must outlive the index and must not be modified.
+     */
+    class RouteIndex {
+    public:
+
+        RouteIndex();
+        explicit RouteIndex(const Blueprint& blueprint);
+        ~RouteIndex();
+
+        /** Index all Actions of a Blueprint, replacing the current content */
+        void build(const Blueprint& blueprint);
+
+        /** Remove all routes */
+        void clear();
+
+        /**
+         *  \brief Resolve a request
+         *  \param method   HTTP method of the request
+         *  \param path     Request path, optionally followed by a query string
+         *  \param match    Matched Action and extracted variables
+         *  \return True if an Action has been found, false otherwise
+         */
+        bool match(const HTTPMethod& method, const std::string& path, RouteMatch& match) const;
+
+        /** \returns Number of indexed Actions */
+        size_t size() const;
+
+        /** \returns Number of Actions left out, unsupported or duplicate */
+        size_t skipped() const;
+
+        struct Node;
+
+    private:
+        Node* m_root;
+        size_t m_size;
+        size_t m_skipped;
+
+        RouteIndex(const RouteIndex&);
+        RouteIndex& operator=(const RouteIndex&);
+    };
+}
+
+#endif
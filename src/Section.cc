@@ -51,7 +51,7 @@ std::string snowcrash::SectionName(const SectionType& section) {
 
 #define ENUM2STRING(ENUM) case ENUM: return #ENUM;
 
-std::string SectionTypeToString(SectionType type) {
+std::string snowcrash::SectionTypeToString(SectionType type) {
 
     switch (type) {
 
@@ -10,6 +10,7 @@
 #define SNOWCRASH_SECTIONPARSER_H
 
 #include <stdexcept>
+#include <typeinfo>
 #include "SectionProcessor.h"
 
 #define ADAPTER_MISMATCH_ERR std::logic_error("mismatched adapter and node type")
@@ -18,8 +19,11 @@ namespace snowcrash {
 
     /**
      *  Blueprint section parser
+     *
+     *  %SourceMapPolicy decides whether the source maps are built, see
+     *  %ExportSourceMapPolicy and %NoSourceMapPolicy.
      */
-    template<typename T, typename Adapter>
+    template<typename T, typename Adapter, typename SourceMapPolicy = RuntimeSourceMapPolicy>
     struct SectionParser {
 
 
@@ -36,27 +40,32 @@ namespace snowcrash {
                                           SectionParserData& pd,
                                           const ParseResultRef<T>& out) {
 
+            SC_INSTRUMENT_SCOPE(pd.statistics, typeid(SectionParser).name());
+            SC_INSTRUMENT_NODE(pd.statistics, pd.sectionContext());
+
+            pd.checkCancellation();
+
             SectionLayout layout = DefaultSectionLayout;
             MarkdownNodeIterator cur = Adapter::startingNode(node);
             const MarkdownNodes& collection = Adapter::startingNodeSiblings(node, siblings);
 
             // Signature node
             MarkdownNodeIterator lastCur = cur;
-            cur = SectionProcessor<T>::processSignature(cur, collection, pd, layout, out);
+            cur = SectionProcessor<T, SourceMapPolicy>::processSignature(cur, collection, pd, layout, out);
 
             // Exclusive Nested Sections Layout
             if (layout == ExclusiveNestedSectionLayout) {
 
                 cur = parseNestedSections(cur, collection, pd, out);
 
-                SectionProcessor<T>::finalize(node, pd, out);
+                SectionProcessor<T, SourceMapPolicy>::finalize(node, pd, out);
 
                 return Adapter::nextStartingNode(node, siblings, cur);
             }
 
             // Parser redirect layout
             if (layout == RedirectSectionLayout) {
-                SectionProcessor<T>::finalize(node, pd, out);
+                SectionProcessor<T, SourceMapPolicy>::finalize(node, pd, out);
 
                 return Adapter::nextStartingNode(node, siblings, cur);
             }
@@ -67,10 +76,12 @@ namespace snowcrash {
 
             // Description nodes
             while(cur != collection.end() &&
-                  SectionProcessor<T>::isDescriptionNode(cur, pd.sectionContext())) {
+                  SectionProcessor<T, SourceMapPolicy>::isDescriptionNode(cur, pd.sectionContext())) {
+
+                SC_INSTRUMENT_NODE(pd.statistics, pd.sectionContext());
 
                 lastCur = cur;
-                cur = SectionProcessor<T>::processDescription(cur, collection, pd, out);
+                cur = SectionProcessor<T, SourceMapPolicy>::processDescription(cur, collection, pd, out);
 
                 if (lastCur == cur)
                     return Adapter::nextStartingNode(node, siblings, cur);
@@ -78,10 +89,12 @@ namespace snowcrash {
 
             // Content nodes
             while(cur != collection.end() &&
-                  SectionProcessor<T>::isContentNode(cur, pd.sectionContext())) {
+                  SectionProcessor<T, SourceMapPolicy>::isContentNode(cur, pd.sectionContext())) {
+
+                SC_INSTRUMENT_NODE(pd.statistics, pd.sectionContext());
 
                 lastCur = cur;
-                cur = SectionProcessor<T>::processContent(cur, collection, pd, out);
+                cur = SectionProcessor<T, SourceMapPolicy>::processContent(cur, collection, pd, out);
 
                 if (lastCur == cur)
                     return Adapter::nextStartingNode(node, siblings, cur);
@@ -90,7 +103,7 @@ namespace snowcrash {
             // Nested Sections
             cur = parseNestedSections(cur, collection, pd, out);
 
-            SectionProcessor<T>::finalize(node, pd, out);
+            SectionProcessor<T, SourceMapPolicy>::finalize(node, pd, out);
 
             return Adapter::nextStartingNode(node, siblings, cur);
         }
@@ -110,18 +123,21 @@ namespace snowcrash {
             // Nested sections
             while(cur != collection.end()) {
 
+                pd.checkCancellation();
+
                 lastCur = cur;
-                SectionType nestedType = SectionProcessor<T>::nestedSectionType(cur);
+                SectionType nestedType = SectionProcessor<T, SourceMapPolicy>::nestedSectionType(cur);
 
                 pd.sectionsContext.push_back(nestedType);
 
                 if (nestedType != UndefinedSectionType) {
-                    cur = SectionProcessor<T>::processNestedSection(cur, collection, pd, out);
+                    cur = SectionProcessor<T, SourceMapPolicy>::processNestedSection(cur, collection, pd, out);
                 }
                 else if (Adapter::nextSkipsUnexpected ||
-                         SectionProcessor<T>::isUnexpectedNode(cur, pd.sectionContext())) {
+                         SectionProcessor<T, SourceMapPolicy>::isUnexpectedNode(cur, pd.sectionContext())) {
 
-                    cur = SectionProcessor<T>::processUnexpectedNode(cur, collection, pd, lastSectionType, out);
+                    SC_INSTRUMENT_NODE(pd.statistics, nestedType);
+                    cur = SectionProcessor<T, SourceMapPolicy>::processUnexpectedNode(cur, collection, pd, lastSectionType, out);
                 }
 
                 if (cur != collection.end() &&
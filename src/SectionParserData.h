@@ -9,7 +9,10 @@
 #ifndef SNOWCRASH_SECTIONPARSERDATA_H
 #define SNOWCRASH_SECTIONPARSERDATA_H
 
+#include "BlueprintEvents.h"
 #include "BlueprintSourcemap.h"
+#include "CancellationToken.h"
+#include "ParseStatistics.h"
 #include "Section.h"
 #include "SymbolTable.h"
 
@@ -23,7 +26,11 @@ namespace snowcrash {
     enum BlueprintParserOption {
         RenderDescriptionsOption = (1 << 0),    /// < Render Markdown in description.
         RequireBlueprintNameOption = (1 << 1),  /// < Treat missing blueprint name as error
-        ExportSourcemapOption = (1 << 2)        /// < Export source maps AST
+        ExportSourcemapOption = (1 << 2),       /// < Export source maps AST
+        SkipBodiesOption = (1 << 3),            /// < Drop payload bodies from the AST
+        SkipSchemasOption = (1 << 4),           /// < Drop payload schemas from the AST
+        SkipDescriptionsOption = (1 << 5),      /// < Drop descriptions from the AST
+        SkipParametersOption = (1 << 6)         /// < Drop URI parameters and their source maps from the AST
     };
 
     typedef unsigned int BlueprintParserOptions;
@@ -37,7 +44,7 @@ namespace snowcrash {
         SectionParserData(BlueprintParserOptions opts,
                           const mdp::ByteBuffer& src,
                           const Blueprint& bp)
-        : options(opts), sourceData(src), blueprint(bp) {}
+        : options(opts), sourceData(src), blueprint(bp), statistics(NULL), cancellation(NULL), events(NULL) {}
 
         /** Parser Options */
         BlueprintParserOptions options;
@@ -54,6 +61,21 @@ namespace snowcrash {
         /** AST being parsed **/
         const Blueprint& blueprint;
 
+        /** Instrumentation statistics to collect, NULL if not collecting */
+        ParseStatistics* statistics;
+
+        /** Cancellation token to check, NULL if parsing can't be cancelled */
+        const CancellationToken* cancellation;
+
+        /**
+         *  \brief Events to emit as entities are completed, NULL if not emitting
+         *
+         *  An entity reported as events is not kept in the AST being parsed.
+         *  Resources are replaced by a summary holding what the checks of later
+         *  sections need, and data structures are dropped.
+         */
+        BlueprintEvents* events;
+
         /** Sections Context */
         typedef std::vector<SectionType> SectionsStack;
         SectionsStack sectionsContext;
@@ -75,16 +97,80 @@ namespace snowcrash {
                 return sectionsContext[size-2];
         }
 
+        /** Throw CancellationException if parsing should stop */
+        void checkCancellation() const {
+            if (cancellation)
+                cancellation->check();
+        }
+
         /** \returns True if exporting source maps */
         bool exportSourceMap() const {
             return options & ExportSourcemapOption;
         }
 
+        /**
+         *  \brief Check whether a content is to be dropped from the AST
+         *
+         *  Skipped content is never copied into the AST. Its source map is
+         *  recorded even if source maps are not exported, the checks of the
+         *  skipped content look at it instead. Exported source maps keep it
+         *  so the content can be fetched from the source later. Parameters are
+         *  the exception, they are dropped together with their source maps
+         *  once they are checked.
+         *
+         *  \param option  One of the skip options
+         *  \returns True if the content is to be dropped
+         */
+        bool skip(BlueprintParserOption option) const {
+            return (options & option) != 0;
+        }
+
+        /** \returns True if a source map covers any of the source data */
+        bool hasSourceData(const mdp::BytesRangeSet& sourceMap) const {
+
+            for (mdp::BytesRangeSet::const_iterator it = sourceMap.begin(); it != sourceMap.end(); ++it) {
+
+                // Stop at a range out of the source data
+                if (it->location + it->length > sourceData.length())
+                    return false;
+
+                if (it->length != 0)
+                    return true;
+            }
+
+            return false;
+        }
+
     private:
         SectionParserData();
         SectionParserData(const SectionParserData&);
         SectionParserData& operator=(const SectionParserData&);
     };
+
+    /**
+     *  \brief Source map export decided by the parser options at runtime
+     *
+     *  Default policy of the section parsers and processors.
+     */
+    struct RuntimeSourceMapPolicy {
+        static bool exportSourceMap(const SectionParserData& pd) {
+            return pd.exportSourceMap();
+        }
+    };
+
+    /** Source maps are always exported */
+    struct ExportSourceMapPolicy {
+        static bool exportSourceMap(const SectionParserData&) {
+            return true;
+        }
+    };
+
+    /** Source maps are never exported, all of the source map work is compiled out */
+    struct NoSourceMapPolicy {
+        static bool exportSourceMap(const SectionParserData&) {
+            return false;
+        }
+    };
 }
 
 #endif
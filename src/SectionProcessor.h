@@ -94,7 +94,7 @@ namespace snowcrash {
     /*
      * Forward Declarations
      */
-    template<typename T>
+    template<typename T, typename SourceMapPolicy = RuntimeSourceMapPolicy>
     struct SectionProcessor;
 
     /**
@@ -103,7 +103,7 @@ namespace snowcrash {
      *  Defines section processor interface alongised with its default
      *  behavior.
      */
-    template<typename T>
+    template<typename T, typename SourceMapPolicy = RuntimeSourceMapPolicy>
     struct SectionProcessorBase {
 
         /**
@@ -130,13 +130,22 @@ namespace snowcrash {
                                                        SectionParserData& pd,
                                                        const ParseResultRef<T>& out) {
 
+            if (pd.skip(SkipDescriptionsOption)) {
+
+                if (pd.hasSourceData(node->sourceMap)) {
+                    out.sourceMap.description.sourceMap.append(node->sourceMap);
+                }
+
+                return ++MarkdownNodeIterator(node);
+            }
+
             if (!out.node.description.empty()) {
                 TwoNewLines(out.node.description);
             }
 
             mdp::ByteBuffer content = mdp::MapBytesRangeSet(node->sourceMap, pd.sourceData);
 
-            if (pd.exportSourceMap() && !content.empty()) {
+            if (SourceMapPolicy::exportSourceMap(pd) && !content.empty()) {
                 out.sourceMap.description.sourceMap.append(node->sourceMap);
             }
 
@@ -205,8 +214,8 @@ namespace snowcrash {
         static bool isDescriptionNode(const MarkdownNodeIterator& node,
                                       SectionType sectionType) {
 
-            if (SectionProcessor<T>::isContentNode(node, sectionType) ||
-                SectionProcessor<T>::nestedSectionType(node) != UndefinedSectionType) {
+            if (SectionProcessor<T, SourceMapPolicy>::isContentNode(node, sectionType) ||
+                SectionProcessor<T, SourceMapPolicy>::nestedSectionType(node) != UndefinedSectionType) {
 
                 return false;
             }
@@ -217,7 +226,7 @@ namespace snowcrash {
                 return true;
             }
 
-            SectionTypes nestedTypes = SectionProcessor<T>::nestedSectionTypes();
+            SectionTypes nestedTypes = SectionProcessor<T, SourceMapPolicy>::nestedSectionTypes();
 
             if (std::find(nestedTypes.begin(), nestedTypes.end(), keywordSectionType) != nestedTypes.end()) {
                 // Node is a keyword defined section defined in one of the nested sections
@@ -239,7 +248,7 @@ namespace snowcrash {
                                      SectionType sectionType) {
 
             SectionType keywordSectionType = SectionKeywordSignature(node);
-            SectionTypes nestedTypes = SectionProcessor<T>::nestedSectionTypes();
+            SectionTypes nestedTypes = SectionProcessor<T, SourceMapPolicy>::nestedSectionTypes();
 
             if (std::find(nestedTypes.begin(), nestedTypes.end(), keywordSectionType) != nestedTypes.end()) {
                 return true;
@@ -267,8 +276,8 @@ namespace snowcrash {
     /**
      *  Default Section Processor
      */
-    template<typename T>
-    struct SectionProcessor : public SectionProcessorBase<T> {
+    template<typename T, typename SourceMapPolicy>
+    struct SectionProcessor : public SectionProcessorBase<T, SourceMapPolicy> {
     };
 }
 
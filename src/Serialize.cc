@@ -10,6 +10,7 @@
 #include <sstream>
 #include <algorithm>
 #include <iterator>
+#include <cstring>
 #include "Serialize.h"
 #include "StringUtility.h"
 
@@ -52,3 +53,116 @@ std::string snowcrash::EscapeDoubleQuotes(const std::string& input)
 {
     return ReplaceString(input, "\"", "\\\"");
 }
+
+static const char Base64Digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static const int VLQBaseShift = 5;
+static const unsigned long VLQBase = 1 << VLQBaseShift;
+static const unsigned long VLQBaseMask = VLQBase - 1;
+static const unsigned long VLQContinuationBit = VLQBase;
+
+/** Stream storage slot of the source map encoding */
+static const int SourceMapEncodingIndex = std::ios_base::xalloc();
+
+/** Append a base64 VLQ value of magnitude `value` */
+static void AppendVLQ(size_t value, bool negative, std::string& out)
+{
+    // Sign is the lowest bit
+    unsigned long vlq = (static_cast<unsigned long>(value) << 1) | (negative ? 1 : 0);
+
+    do {
+        unsigned long digit = vlq & VLQBaseMask;
+        vlq >>= VLQBaseShift;
+
+        if (vlq > 0)
+            digit |= VLQContinuationBit;
+
+        out += Base64Digits[digit];
+    } while (vlq > 0);
+}
+
+/** Read a base64 VLQ value, returns false on an invalid or truncated value */
+static bool ReadVLQ(const std::string& encoded, size_t& position, size_t& value, bool& negative)
+{
+    unsigned long vlq = 0;
+    int shift = 0;
+    unsigned long digit;
+
+    do {
+        if (position >= encoded.length() || shift >= static_cast<int>(sizeof(unsigned long) * 8))
+            return false;
+
+        const char* found = std::strchr(Base64Digits, encoded[position++]);
+
+        if (!found || *found == '\0')
+            return false;
+
+        digit = static_cast<unsigned long>(found - Base64Digits);
+        vlq |= (digit & VLQBaseMask) << shift;
+        shift += VLQBaseShift;
+    } while (digit & VLQContinuationBit);
+
+    negative = (vlq & 1);
+    value = static_cast<size_t>(vlq >> 1);
+    return true;
+}
+
+std::string snowcrash::EncodeSourceMapVLQ(const mdp::BytesRangeSet& sourceMap)
+{
+    std::string encoded;
+    size_t end = 0;
+
+    for (mdp::BytesRangeSet::const_iterator it = sourceMap.begin(); it != sourceMap.end(); ) {
+
+        size_t location = it->location;
+        size_t length = it->length;
+
+        // Merge adjacent ranges
+        for (++it; it != sourceMap.end() && it->location == location + length; ++it)
+            length += it->length;
+
+        if (location >= end)
+            AppendVLQ(location - end, false, encoded);
+        else
+            AppendVLQ(end - location, true, encoded);
+
+        AppendVLQ(length, false, encoded);
+        end = location + length;
+    }
+
+    return encoded;
+}
+
+bool snowcrash::DecodeSourceMapVLQ(const std::string& encoded, mdp::BytesRangeSet& sourceMap)
+{
+    size_t position = 0;
+    size_t end = 0;
+
+    while (position < encoded.length()) {
+
+        size_t delta, length;
+        bool negative, negativeLength;
+
+        if (!ReadVLQ(encoded, position, delta, negative) ||
+            !ReadVLQ(encoded, position, length, negativeLength) ||
+            negativeLength ||
+            (negative && delta > end))
+            return false;
+
+        mdp::BytesRange range(negative ? end - delta : end + delta, length);
+        sourceMap.push_back(range);
+        end = range.location + range.length;
+    }
+
+    return true;
+}
+
+SourceMapEncoding snowcrash::GetSourceMapEncoding(std::ios_base& ios)
+{
+    return static_cast<SourceMapEncoding>(ios.iword(SourceMapEncodingIndex));
+}
+
+void snowcrash::SetSourceMapEncoding(std::ios_base& ios, SourceMapEncoding encoding)
+{
+    ios.iword(SourceMapEncodingIndex) = encoding;
+}
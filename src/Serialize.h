@@ -10,6 +10,8 @@
 #define SNOWCRASH_SERIALIZE_H
 
 #include <string>
+#include <ios>
+#include "ByteBuffer.h"
 
 /** Version of API Blueprint AST serialization */
 #define AST_SERIALIZATION_VERSION "2.1"
@@ -32,6 +34,47 @@ namespace snowcrash {
      */
     std::string EscapeDoubleQuotes(const std::string& input);
 
+    /**
+     *  \brief Source map serialization encodings
+     */
+    enum SourceMapEncoding {
+        RangesSourceMapEncoding = 0,    /// < Array of `[location, length]` pairs per source map
+        VLQSourceMapEncoding            /// < Base64 VLQ string per source map, see EncodeSourceMapVLQ
+    };
+
+    /**
+     *  \brief  Encode a source map as a base64 VLQ string.
+     *  \param  sourceMap   A source map to encode.
+     *  \return The encoded source map.
+     *
+     *  Adjacent ranges are merged first. Every range is then encoded as two
+     *  values: its location relative to the end of the previous range (the
+     *  first range relative to 0) and its length. Values use the base64 VLQ
+     *  of JavaScript source maps: the sign in the lowest bit and five bits per
+     *  digit with a continuation bit. Every source map is encoded on its own
+     *  so that it can be decoded without the rest of the serialization.
+     */
+    std::string EncodeSourceMapVLQ(const mdp::BytesRangeSet& sourceMap);
+
+    /**
+     *  \brief  Decode a base64 VLQ source map string.
+     *  \param  encoded     A string produced by EncodeSourceMapVLQ.
+     *  \param  sourceMap   Source map to append the decoded ranges to.
+     *  \return False if the string is not a valid encoded source map.
+     */
+    bool DecodeSourceMapVLQ(const std::string& encoded, mdp::BytesRangeSet& sourceMap);
+
+    /**
+     *  \brief  Source map encoding selected for serialization into a stream.
+     *
+     *  The encoding is kept in the stream, it is inherited by streams copying
+     *  its format with `copyfmt()`.
+     */
+    SourceMapEncoding GetSourceMapEncoding(std::ios_base& ios);
+
+    /** \brief Select source map encoding for serialization into a stream */
+    void SetSourceMapEncoding(std::ios_base& ios, SourceMapEncoding encoding);
+
     /**
      *  AST entities serialization keys
      */
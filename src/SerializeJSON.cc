@@ -6,8 +6,10 @@
 //  Copyright (c) 2013 Apiary Inc. All rights reserved.
 //
 
+#include <sstream>
 #include "SerializeJSON.h"
 #include "Serialize.h"
+#include "ParallelFor.h"
 
 using namespace snowcrash;
 
@@ -110,12 +112,20 @@ static void serialize(const std::string& key, const std::string& value, size_t l
 
 /**
  * \brief Serialize source map without key into output stream
+ *
+ * Source map is serialized as a string if the stream has VLQSourceMapEncoding selected.
+ *
  * \param set      Source map
  * \param level    Indentation level
  * \param os       An output stream to serialize into
  */
 static void serialize(const SourceMapBase& set, size_t level, std::ostream &os)
 {
+    if (GetSourceMapEncoding(os) == VLQSourceMapEncoding) {
+        serialize(EncodeSourceMapVLQ(set.sourceMap), os);
+        return;
+    }
+
     os << "[";
 
     if (!set.sourceMap.empty()) {
@@ -131,7 +141,7 @@ static void serialize(const SourceMapBase& set, size_t level, std::ostream &os)
             os << "[" << it->location << ", " << it->length << "]";
         }
 
-        os << std::endl;
+        os << "\n";
         indent(level, os);
     }
 
@@ -338,7 +348,7 @@ static void serialize(const Parameters& parameters, size_t level, std::ostream &
             os << "}";
         }
 
-        os << std::endl;
+        os << "\n";
         indent(level, os);
     }
 
@@ -427,7 +437,7 @@ static void serialize(const Collection<SourceMap<Parameter> >::type& parameters,
             os << "}";
         }
 
-        os << std::endl;
+        os << "\n";
         indent(level, os);
     }
 
@@ -1092,43 +1102,44 @@ static void serialize(const SourceMap<ResourceGroup>& resourceGroup, std::ostrea
     os << "}";
 }
 
-/**
- * \brief Serialize Resource Groups into output stream.
- * \param resourceGroups Resource Groups to serialize.
- * \param os             An output stream to serialize into.
- */
-static void serialize(const ResourceGroups& resourceGroups, std::ostream &os)
-{
-    indent(1, os);
-    serialize(SerializeKey::ResourceGroups, os);
-    os << ": ";
-    os << "[";
+namespace {
 
-    if (!resourceGroups.empty()) {
-        os << "\n";
-        size_t i = 0;
+    /**
+     * \brief Resource groups rendered into their own buffers.
+     *
+     * Resource groups are serialized at a fixed indentation level, every
+     * group can be rendered independently of the others and the buffers
+     * written in order yield the serial output.
+     */
+    template <typename T>
+    struct ResourceGroupsBuffers {
 
-        for (Collection<ResourceGroup>::const_iterator it = resourceGroups.begin(); it != resourceGroups.end(); ++i, ++it) {
+        ResourceGroupsBuffers(const std::vector<T>& groups_, const std::ios& format_)
+        : groups(groups_), format(format_), buffers(groups_.size()) {}
 
-            if (i > 0 && i < resourceGroups.size())
-                os << NewLineItemBlock;
+        const std::vector<T>& groups;
+        const std::ios& format;
+        std::vector<std::string> buffers;
 
-            serialize(*it, os);
-        }
-
-        os << "\n";
-        indent(1, os);
-    }
+        static void render(size_t index, void* context) {
+            ResourceGroupsBuffers* self = static_cast<ResourceGroupsBuffers*>(context);
 
-    os << "]";
+            std::stringstream ss;
+            ss.copyfmt(self->format);
+            serialize(self->groups[index], ss);
+            self->buffers[index] = ss.str();
+        }
+    };
 }
 
 /**
- * \brief Serialize Resource Groups source map into output stream.
- * \param resourceGroups Resource Groups source map to serialize.
+ * \brief Serialize Resource Groups into output stream.
+ * \param resourceGroups Resource Groups to serialize.
+ * \param threads        Number of threads rendering the groups, 1 to serialize on the calling thread.
  * \param os             An output stream to serialize into.
  */
-static void serialize(const Collection<SourceMap<ResourceGroup> >::type& resourceGroups, std::ostream &os)
+template <typename T>
+static void serializeResourceGroups(const std::vector<T>& resourceGroups, size_t threads, std::ostream &os)
 {
     indent(1, os);
     serialize(SerializeKey::ResourceGroups, os);
@@ -1137,14 +1148,27 @@ static void serialize(const Collection<SourceMap<ResourceGroup> >::type& resourc
 
     if (!resourceGroups.empty()) {
         os << "\n";
-        size_t i = 0;
 
-        for (Collection<SourceMap<ResourceGroup> >::const_iterator it = resourceGroups.begin(); it != resourceGroups.end(); ++i, ++it) {
+        if (threads > 1) {
+            ResourceGroupsBuffers<T> rendered(resourceGroups, os);
+            ParallelFor(resourceGroups.size(), threads, ResourceGroupsBuffers<T>::render, &rendered);
 
-            if (i > 0 && i < resourceGroups.size())
-                os << NewLineItemBlock;
+            for (size_t i = 0; i < rendered.buffers.size(); ++i) {
 
-            serialize(*it, os);
+                if (i > 0)
+                    os << NewLineItemBlock;
+
+                os.write(rendered.buffers[i].data(), rendered.buffers[i].size());
+            }
+        }
+        else {
+            for (size_t i = 0; i < resourceGroups.size(); ++i) {
+
+                if (i > 0)
+                    os << NewLineItemBlock;
+
+                serialize(resourceGroups[i], os);
+            }
         }
 
         os << "\n";
@@ -1157,9 +1181,10 @@ static void serialize(const Collection<SourceMap<ResourceGroup> >::type& resourc
 /**
  * \brief Serialize a blueprint into output stream.
  * \param blueprint     The blueprint to serialize.
+ * \param threads       Number of threads rendering the resource groups.
  * \param os            An output stream to serialize into.
  */
-static void serialize(const Blueprint& blueprint, std::ostream &os)
+static void serialize(const Blueprint& blueprint, size_t threads, std::ostream &os)
 {
     os << "{\n";
 
@@ -1179,7 +1204,7 @@ static void serialize(const Blueprint& blueprint, std::ostream &os)
     os << NewLineItemBlock;
 
     // Resource Groups
-    serialize(blueprint.resourceGroups, os);
+    serializeResourceGroups(blueprint.resourceGroups, threads, os);
 
     os << "\n}\n";
 }
@@ -1187,9 +1212,10 @@ static void serialize(const Blueprint& blueprint, std::ostream &os)
 /**
  * \brief Serialize a blueprint source map into output stream.
  * \param blueprint     The blueprint source map to serialize.
+ * \param threads       Number of threads rendering the resource groups.
  * \param os            An output stream to serialize into.
  */
-static void serialize(const SourceMap<Blueprint>& blueprint, std::ostream &os)
+static void serialize(const SourceMap<Blueprint>& blueprint, size_t threads, std::ostream &os)
 {
     os << "{\n";
 
@@ -1205,17 +1231,17 @@ static void serialize(const SourceMap<Blueprint>& blueprint, std::ostream &os)
     os << NewLineItemBlock;
 
     // Resource Groups
-    serialize(blueprint.resourceGroups.collection, os);
+    serializeResourceGroups(blueprint.resourceGroups.collection, threads, os);
 
     os << "\n}\n";
 }
 
-void snowcrash::SerializeJSON(const snowcrash::Blueprint& blueprint, std::ostream &os)
+void snowcrash::SerializeJSON(const snowcrash::Blueprint& blueprint, std::ostream &os, size_t threads)
 {
-    serialize(blueprint, os);
+    serialize(blueprint, threads, os);
 }
 
-void snowcrash::SerializeSourceMapJSON(const snowcrash::SourceMap<snowcrash::Blueprint>& blueprint, std::ostream &os)
+void snowcrash::SerializeSourceMapJSON(const snowcrash::SourceMap<snowcrash::Blueprint>& blueprint, std::ostream &os, size_t threads)
 {
-    serialize(blueprint, os);
+    serialize(blueprint, threads, os);
 }
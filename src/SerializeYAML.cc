@@ -6,12 +6,14 @@
 //  Copyright (c) 2013 Apiary Inc. All rights reserved.
 //
 
+#include <sstream>
 #include "Serialize.h"
 #include "SerializeYAML.h"
+#include "ParallelFor.h"
 
 using namespace snowcrash;
 
-static std::string ReservedCharacters = "#-[]:|>!*&%@`,{}?\'";
+static const std::string ReservedCharacters = "#-[]:|>!*&%@`,{}?\'";
 
 /** Normalizes string value for use in YAML and checks whether quotation is need */
 static std::string NormalizeStringValue(const std::string& value, bool& needsQuotation)
@@ -81,18 +83,23 @@ static void serialize(const std::string& key, const std::string& value, size_t l
                 os << value;
         }
 
-        os << std::endl;
+        os << "\n";
     }
     else
         os << key << ":\n";
 }
 
-/** Serialize source map without key into output stream */
+/** Serialize source map without key into output stream, as a string if VLQSourceMapEncoding is selected */
 static void serialize(const SourceMapBase& set, size_t level, std::ostream &os)
 {
+    if (GetSourceMapEncoding(os) == VLQSourceMapEncoding) {
+        os << " \"" << EncodeSourceMapVLQ(set.sourceMap) << "\"\n";
+        return;
+    }
+
     if (!set.sourceMap.empty()) {
         size_t i = 0;
-        os << std::endl;
+        os << "\n";
 
         for (mdp::RangeSet<mdp::BytesRange>::const_iterator it = set.sourceMap.begin(); it != set.sourceMap.end(); ++i, ++it) {
 
@@ -636,8 +643,50 @@ static void serialize(const SourceMap<ResourceGroup>& group, std::ostream &os)
     }
 }
 
+namespace {
+
+    /** Resource groups rendered into their own buffers, groups are serialized at a fixed indentation level */
+    template <typename T>
+    struct ResourceGroupsBuffers {
+
+        ResourceGroupsBuffers(const std::vector<T>& groups_, const std::ios& format_)
+        : groups(groups_), format(format_), buffers(groups_.size()) {}
+
+        const std::vector<T>& groups;
+        const std::ios& format;
+        std::vector<std::string> buffers;
+
+        static void render(size_t index, void* context) {
+            ResourceGroupsBuffers* self = static_cast<ResourceGroupsBuffers*>(context);
+
+            std::stringstream ss;
+            ss.copyfmt(self->format);
+            serialize(self->groups[index], ss);
+            self->buffers[index] = ss.str();
+        }
+    };
+}
+
+/** Serialize Resource Groups, rendered on up to `threads` threads */
+template <typename T>
+static void serializeResourceGroups(const std::vector<T>& resourceGroups, size_t threads, std::ostream &os)
+{
+    if (threads <= 1) {
+        for (typename std::vector<T>::const_iterator it = resourceGroups.begin(); it != resourceGroups.end(); ++it)
+            serialize(*it, os);
+
+        return;
+    }
+
+    ResourceGroupsBuffers<T> rendered(resourceGroups, os);
+    ParallelFor(resourceGroups.size(), threads, ResourceGroupsBuffers<T>::render, &rendered);
+
+    for (std::vector<std::string>::const_iterator it = rendered.buffers.begin(); it != rendered.buffers.end(); ++it)
+        os.write(it->data(), it->size());
+}
+
 /** Serialize Blueprint */
-static void serialize(const Blueprint& blueprint, std::ostream &os)
+static void serialize(const Blueprint& blueprint, size_t threads, std::ostream &os)
 {
     // AST Version
     serialize(SerializeKey::ASTVersion, AST_SERIALIZATION_VERSION, 0, os, false);
@@ -654,19 +703,11 @@ static void serialize(const Blueprint& blueprint, std::ostream &os)
     // Resource Groups
     serialize(SerializeKey::ResourceGroups, std::string(), 0, os);
 
-    if (blueprint.resourceGroups.empty())
-        return;
-
-    for (Collection<ResourceGroup>::type::const_iterator it = blueprint.resourceGroups.begin();
-         it != blueprint.resourceGroups.end();
-         ++it) {
-
-        serialize(*it, os);
-    }
+    serializeResourceGroups(blueprint.resourceGroups, threads, os);
 }
 
 /** Serialize Blueprint source map */
-static void serialize(const SourceMap<Blueprint>& blueprint, std::ostream &os)
+static void serialize(const SourceMap<Blueprint>& blueprint, size_t threads, std::ostream &os)
 {
     // Metadata
     serialize(blueprint.metadata.collection, os);
@@ -680,23 +721,15 @@ static void serialize(const SourceMap<Blueprint>& blueprint, std::ostream &os)
     // Resource Groups
     serialize(SerializeKey::ResourceGroups, std::string(), 0, os);
 
-    if (blueprint.resourceGroups.collection.empty())
-        return;
-
-    for (Collection<SourceMap<ResourceGroup> >::type::const_iterator it = blueprint.resourceGroups.collection.begin();
-         it != blueprint.resourceGroups.collection.end();
-         ++it) {
-
-        serialize(*it, os);
-    }
+    serializeResourceGroups(blueprint.resourceGroups.collection, threads, os);
 }
 
-void snowcrash::SerializeYAML(const snowcrash::Blueprint& blueprint, std::ostream &os)
+void snowcrash::SerializeYAML(const snowcrash::Blueprint& blueprint, std::ostream &os, size_t threads)
 {
-    serialize(blueprint, os);
+    serialize(blueprint, threads, os);
 }
 
-void snowcrash::SerializeSourceMapYAML(const snowcrash::SourceMap<snowcrash::Blueprint>& blueprint, std::ostream &os)
+void snowcrash::SerializeSourceMapYAML(const snowcrash::SourceMap<snowcrash::Blueprint>& blueprint, std::ostream &os, size_t threads)
 {
-    serialize(blueprint, os);
+    serialize(blueprint, threads, os);
 }
@@ -11,14 +11,18 @@
 
 #include <ostream>
 #include "BlueprintSourcemap.h"
+#include "Serialize.h"
 
 namespace snowcrash {
 
     // Naive YAML serialization to ostream
-    void SerializeYAML(const snowcrash::Blueprint& blueprint, std::ostream &os);
+    // Resource groups are rendered on up to `threads` threads, the output
+    // is the same for any number of threads
+    void SerializeYAML(const snowcrash::Blueprint& blueprint, std::ostream &os, size_t threads = 1);
 
     // Naive Sourcmap YAML serialization to ostream
-    void SerializeSourceMapYAML(const snowcrash::SourceMap<snowcrash::Blueprint>& blueprint, std::ostream &os);
+    // Source maps are encoded as selected by SetSourceMapEncoding() on `os`
+    void SerializeSourceMapYAML(const snowcrash::SourceMap<snowcrash::Blueprint>& blueprint, std::ostream &os, size_t threads = 1);
 }
 
 #endif
@@ -67,16 +67,66 @@ SectionType snowcrash::SectionKeywordSignature(const mdp::MarkdownNodeIterator&
 SectionType snowcrash::RecognizeCodeBlockFirstLine(const mdp::ByteBuffer& subject)
 {
     SectionType type = UndefinedSectionType;
+    StringView line(subject);
 
-    if (RegexMatch(subject, HeadersRegex)) {
+    if (MatchSectionKeyword(line, "Header", true)) {
         return HeadersSectionType;
     }
-    else if (RegexMatch(subject, BodyRegex)) {
+    else if (MatchSectionKeyword(line, "Body")) {
         return BodySectionType;
     }
-    else if (RegexMatch(subject, SchemaRegex)) {
+    else if (MatchSectionKeyword(line, "Schema")) {
         return SchemaSectionType;
     }
 
     return type;
 }
+
+/** \returns True if the character is a space or tab, same as `[[:blank:]]` */
+static bool IsBlank(char c)
+{
+    return c == ' ' || c == '\t';
+}
+
+bool snowcrash::MatchSectionKeyword(const StringView& subject, const char* keyword, bool plural)
+{
+    const char* it = subject.begin();
+    const char* end = subject.end();
+    bool wordStart = true;
+
+    while (it != end && IsBlank(*it))
+        ++it;
+
+    for (; *keyword; ++keyword) {
+
+        if (*keyword == ' ') {
+
+            if (it == end || !IsBlank(*it))
+                return false;
+
+            while (it != end && IsBlank(*it))
+                ++it;
+
+            wordStart = true;
+            continue;
+        }
+
+        if (it == end)
+            return false;
+
+        if (*it != *keyword &&
+            !(wordStart && *keyword >= 'A' && *keyword <= 'Z' && *it == *keyword - 'A' + 'a'))
+            return false;
+
+        ++it;
+        wordStart = false;
+    }
+
+    if (plural && it != end && *it == 's')
+        ++it;
+
+    while (it != end && IsBlank(*it))
+        ++it;
+
+    return it == end;
+}
@@ -11,6 +11,7 @@
 
 #include "MarkdownNode.h"
 #include "Section.h"
+#include "StringUtility.h"
 
 namespace snowcrash {
 
@@ -27,6 +28,21 @@ namespace snowcrash {
      *  \return SectionType Type of the section if the line contains a keyword
      */
     extern SectionType RecognizeCodeBlockFirstLine(const mdp::ByteBuffer& subject);
+
+    /**
+     *  \brief Match a section keyword such as `Headers` or `Data Structures`.
+     *
+     *  Every word of the keyword starts with an upper-case letter which matches in
+     *  either case, words are separated by one or more blanks. Blanks around the
+     *  keyword are ignored. Nothing is copied, the subject is usually a view of
+     *  a Markdown node text.
+     *
+     *  \param subject  Text to match.
+     *  \param keyword  Keyword to look for.
+     *  \param plural   True if the keyword can be followed by 's'.
+     *  \return True if the subject is the keyword.
+     */
+    extern bool MatchSectionKeyword(const StringView& subject, const char* keyword, bool plural = false);
 }
 
 #endif
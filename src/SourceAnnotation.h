@@ -101,7 +101,9 @@ namespace snowcrash {
         NoError = 0,
         ApplicationError = 1,
         BusinessError = 2,
-        SymbolError = 3
+        SymbolError = 3,
+        CancelledError = 4,
+        DeadlineExceededError = 5
     };
 
     /**
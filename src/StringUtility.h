@@ -14,6 +14,7 @@
 #include <algorithm>
 #include <functional>
 #include <cctype>
+#include <cstddef>
 #include <locale>
 #include <string>
 #include <sstream>
@@ -125,6 +126,137 @@ namespace snowcrash {
         return elem.front();
     }
 
+    /**
+     *  \brief  Non-owning view of a part of a string.
+     *
+     *  The viewed string must outlive the view and must not be
+     *  modified while the view is in use.
+     */
+    struct StringView {
+
+        StringView() : data(NULL), length(0) {}
+
+        StringView(const char* data_, size_t length_)
+        : data(data_), length(length_) {}
+
+        explicit StringView(const std::string& s)
+        : data(s.data()), length(s.length()) {}
+
+        /** First character of the view */
+        const char* data;
+
+        /** Number of characters in the view */
+        size_t length;
+
+        bool empty() const {
+            return length == 0;
+        }
+
+        const char* begin() const {
+            return data;
+        }
+
+        const char* end() const {
+            return data + length;
+        }
+
+        char operator[](size_t i) const {
+            return data[i];
+        }
+
+        /** \return A copy of the viewed characters */
+        std::string str() const {
+            return std::string(data, length);
+        }
+    };
+
+    inline bool operator==(const StringView& view, const std::string& s) {
+        return view.length == s.length() && s.compare(0, s.length(), view.data, view.length) == 0;
+    }
+
+    // Trim view from start
+    inline StringView TrimViewStart(StringView v) {
+        while (v.length && isSpace(*v.data)) {
+            ++v.data;
+            --v.length;
+        }
+        return v;
+    }
+
+    // Trim view from end
+    inline StringView TrimViewEnd(StringView v) {
+        while (v.length && isSpace(v.data[v.length - 1])) {
+            --v.length;
+        }
+        return v;
+    }
+
+    // Trim both ends of view
+    inline StringView TrimView(StringView v) {
+        return TrimViewStart(TrimViewEnd(v));
+    }
+
+    /**
+     *  \brief  View the first line of a string, see `GetFirstLine()`.
+     *
+     *  \param  s   Subject of the extraction
+     *  \param  r   Remaining content after the first line feed, empty if there is none
+     *  \return First line of the subject without the line feed
+     */
+    inline StringView FirstLineView(StringView s, StringView& r) {
+        const char* lf = std::find(s.begin(), s.end(), '\n');
+        if (lf == s.end()) {
+            r = StringView(s.end(), 0);
+            return s;
+        }
+        r = StringView(lf + 1, s.end() - (lf + 1));
+        return StringView(s.data, lf - s.data);
+    }
+
+    /**
+     *  \brief  Iterate over the lines of a string without copying them.
+     *
+     *  Yields the same lines as `Split(s, '\n')`: an empty subject has
+     *  no lines and a trailing line feed does not start a new line.
+     */
+    class LineIterator {
+    public:
+        explicit LineIterator(StringView s) : m_rest(s) {}
+
+        /**
+         *  \brief  Advance to the next line.
+         *  \param  line    Set to the next line without its line feed
+         *  \return False if there are no more lines
+         */
+        bool next(StringView& line) {
+            if (m_rest.empty())
+                return false;
+            line = FirstLineView(m_rest, m_rest);
+            return true;
+        }
+
+    private:
+        StringView m_rest;
+    };
+
+    /**
+     *  \brief  Split a line on the first occurrence of a delimiter.
+     *
+     *  \param  line    A line to split
+     *  \param  delim   The key-value delimiter
+     *  \param  key     Trimmed part of the line before the delimiter
+     *  \param  value   Trimmed part of the line after the delimiter
+     *  \return False if the line does not contain the delimiter
+     */
+    inline bool SplitKeyValue(StringView line, char delim, StringView& key, StringView& value) {
+        const char* pos = std::find(line.begin(), line.end(), delim);
+        if (pos == line.end())
+            return false;
+        key = TrimView(StringView(line.data, pos - line.data));
+        value = TrimView(StringView(pos + 1, line.end() - (pos + 1)));
+        return true;
+    }
+
 
     /**
      *  \brief  compare equality  - allow compare diferent types
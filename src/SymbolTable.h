@@ -73,6 +73,45 @@ namespace snowcrash {
         return false;
     }
 
+    // Checks whether given text surrounded by white space represents reference to a symbol
+    // without copying the text. If so, range of the trimmed referred symbol name is filled in.
+    inline bool FindSymbolReference(const mdp::ByteBuffer& text,
+                                    mdp::BytesRange& referredSymbol) {
+
+        size_t begin = 0;
+        size_t end = text.length();
+
+        while (begin < end && isSpace(text[begin]))
+            ++begin;
+
+        // Most of the assets are not references, bail out on the first character
+        if (begin == end || text[begin] != '[')
+            return false;
+
+        while (end > begin && isSpace(text[end - 1]))
+            --end;
+
+        if (end - begin < 5 || text.compare(end - 3, 3, "][]") != 0)
+            return false;
+
+        ++begin;
+        end -= 3;
+
+        for (size_t i = begin; i < end; ++i) {
+            if (text[i] == '[' || text[i] == ']' || text[i] == '(' || text[i] == ')')
+                return false;
+        }
+
+        while (begin < end && isSpace(text[begin]))
+            ++begin;
+
+        while (end > begin && isSpace(text[end - 1]))
+            --end;
+
+        referredSymbol = mdp::BytesRange(begin, end - begin);
+        return true;
+    }
+
 #ifdef DEBUG
     // Prints markdown block recursively to stdout
     inline void PrintSymbolTable(const SymbolTable& symbolTable) {
@@ -5,191 +5,311 @@
 //  Created by Carl Griffiths on 24/02/14.
 //  Copyright (c) 2014 Apiary Inc. All rights reserved.
 //
-#include <iomanip>
+#include <cstring>
+#include <sstream>
 #include "UriTemplateParser.h"
-#include "RegexMatch.h"
 
 using namespace snowcrash;
 
-static bool HasMismatchedCurlyBrackets(const URITemplate& uriTemplate) {
-    int openCount = 0;
-    int closeCount = 0;
+/** Supported URI schemes, longer ones first */
+static const char* const URISchemes[] = { "https", "http", "file", "ftp" };
 
-    for (unsigned int i = 0; i < uriTemplate.length(); i++) {
-        if (uriTemplate[i] == '{') openCount++;
-        if (uriTemplate[i] == '}') closeCount++;
+/** Character classes of URI template expression names */
+enum ExpressionCharacterClass {
+    OtherCharacterClass = 0,
+    NameCharacterClass = 1,         /// < A-Z a-z 0-9 _ , | and '.' standing for '_'
+    HexDigitCharacterClass = 2      /// < A-F a-f 0-9 | in percent encoded characters
+};
+
+/** Lookup table of character classes */
+struct NameCharacterTable {
+
+    unsigned char classes[256];
+
+    NameCharacterTable() {
+
+        ::memset(classes, OtherCharacterClass, sizeof(classes));
+
+        for (int c = 'A'; c <= 'Z'; ++c)
+            classes[c] = NameCharacterClass;
+
+        for (int c = 'a'; c <= 'z'; ++c)
+            classes[c] = NameCharacterClass;
+
+        for (int c = '0'; c <= '9'; ++c)
+            classes[c] = NameCharacterClass | HexDigitCharacterClass;
+
+        for (int c = 'A'; c <= 'F'; ++c)
+            classes[c] |= HexDigitCharacterClass;
+
+        for (int c = 'a'; c <= 'f'; ++c)
+            classes[c] |= HexDigitCharacterClass;
+
+        classes[static_cast<unsigned char>('_')] = NameCharacterClass;
+        classes[static_cast<unsigned char>(',')] = NameCharacterClass;
+        classes[static_cast<unsigned char>('.')] = NameCharacterClass;
+        classes[static_cast<unsigned char>('|')] = NameCharacterClass | HexDigitCharacterClass;
     }
-    return openCount != closeCount;
-}
 
-static bool HasNestedCurlyBrackets(const URITemplate& uriTemplate) {
-    char lastBracket = ' ';
-    bool result = false;
+    bool is(char c, ExpressionCharacterClass characterClass) const {
+        return (classes[static_cast<unsigned char>(c)] & characterClass) != 0;
+    }
+};
 
-    for (unsigned int i = 0; i < uriTemplate.length(); i++) {
-        if (uriTemplate[i] == '{') {
-            if (lastBracket == '{') {
-                result = true;
-                break;
-            }
-            lastBracket = '{';
+static const NameCharacterTable NameCharacters;
+
+/**
+ *  \brief Check characters of an expression
+ *
+ *  An optional operator followed by name characters and percent
+ *  encoded characters, optionally ending with the explode modifier.
+ */
+static bool IsInvalidExpressionName(const Expression& expression)
+{
+    if (expression.empty() || expression.find("..") != std::string::npos)
+        return true;
+
+    size_t i = 0;
+    size_t length = expression.length();
+
+    if (::strchr("?|#+&", expression[0]))
+        ++i;
+
+    while (i < length) {
+
+        if (NameCharacters.is(expression[i], NameCharacterClass)) {
+            ++i;
         }
-        if (uriTemplate[i] == '}') {
-            if (lastBracket == '}') {
-                result = true;
-                break;
-            }
-            lastBracket = '}';
+        else if (expression[i] == '%' &&
+                 i + 2 < length &&
+                 NameCharacters.is(expression[i + 1], HexDigitCharacterClass) &&
+                 NameCharacters.is(expression[i + 2], HexDigitCharacterClass)) {
+            i += 3;
+        }
+        else {
+            break;
         }
     }
-    return result;
+
+    if (i < length && expression[i] == '*')
+        ++i;
+
+    return i != length;
 }
 
-static bool PathContainsSquareBrackets(const URITemplate& uriTemplate) {
-    return (uriTemplate.find('[') != std::string::npos || uriTemplate.find(']') != std::string::npos);
+bool ClassifiedExpression::IsSupportedExpressionType() const
+{
+    switch (type) {
+        case VariableExpressionType:
+        case QueryStringExpressionType:
+        case FragmentExpressionType:
+        case ReservedExpansionExpressionType:
+        case FormStyleQueryContinuationExpressionType:
+            return true;
+
+        default:
+            return false;
+    }
 }
 
-static Expressions GetUriTemplateExpressions(const URITemplate& uriTemplate) {
-    Expressions expressions;
-    size_t expressionStartPos = 0;
-    size_t expressionEndPos = 0;
+const char* ClassifiedExpression::UnsupportedWarningText() const
+{
+    switch (type) {
+        case LabelExpansionExpressionType:
+            return "URI template label expansion is not supported";
 
-    while (expressionStartPos != std::string::npos && expressionEndPos != std::string::npos && expressionStartPos < uriTemplate.length()) {
-        expressionStartPos = uriTemplate.find("{", expressionStartPos);
-        expressionEndPos = uriTemplate.find("}", expressionStartPos);
-        if (expressionStartPos != std::string::npos && expressionEndPos > expressionStartPos) {
-            expressions.push_back(uriTemplate.substr(expressionStartPos + 1, (expressionEndPos - expressionStartPos) - 1));
-        }
-        expressionStartPos++;
+        // Path style parameters have always been reported as path segments
+        case PathSegmentExpansionExpressionType:
+        case PathStyleParameterExpansionExpressionType:
+            return "URI template path segment expansion is not supported";
+
+        case UndefinedExpressionType:
+            return "Unidentified expression";
+
+        default:
+            return "";
     }
-    return expressions;
 }
 
+ClassifiedExpression URITemplateParser::classifyExpression(const Expression& expression)
+{
+    if (expression.empty())
+        return ClassifiedExpression(expression, VariableExpressionType);
 
-static ClassifiedExpression ClassifyExpression(const Expression& expression) {
+    switch (expression[0]) {
+        case '?':
+            return ClassifiedExpression(expression, QueryStringExpressionType);
 
-    VariableExpression variableExpression(expression);
+        case '#':
+            return ClassifiedExpression(expression, FragmentExpressionType);
 
-    if (variableExpression.IsExpressionType()) {
-        return variableExpression;
-    }
+        case '+':
+            return ClassifiedExpression(expression, ReservedExpansionExpressionType);
 
-    QueryStringExpression queryStringExpression(expression);
-    if (queryStringExpression.IsExpressionType()) {
-        return queryStringExpression;
-    }
+        case '.':
+            return ClassifiedExpression(expression, LabelExpansionExpressionType);
 
-    FragmentExpression fragmentExpression(expression);
-    if (fragmentExpression.IsExpressionType()) {
-        return fragmentExpression;
-    }
+        case '/':
+            return ClassifiedExpression(expression, PathSegmentExpansionExpressionType);
 
-    ReservedExpansionExpression reservedExpansionExpression(expression);
-    if (reservedExpansionExpression.IsExpressionType()) {
-        return reservedExpansionExpression;
-    }
+        case ';':
+            return ClassifiedExpression(expression, PathStyleParameterExpansionExpressionType);
 
-    LabelExpansionExpression labelExpansionExpression(expression);
-    if (labelExpansionExpression.IsExpressionType()) {
-        return labelExpansionExpression;
+        case '&':
+            return ClassifiedExpression(expression, FormStyleQueryContinuationExpressionType);
+
+        case '|':
+            return ClassifiedExpression(expression, UndefinedExpressionType);
+
+        default:
+            return ClassifiedExpression(expression, VariableExpressionType);
     }
+}
+
+/** Split URI into scheme, host and path */
+static void SplitURI(const URITemplate& uri, ParsedURITemplate& result)
+{
+    size_t position = 0;
 
-    PathSegmentExpansionExpression pathSegmentExpansionExpression(expression);
-    if (pathSegmentExpansionExpression.IsExpressionType()) {
-        return pathSegmentExpansionExpression;
+    for (size_t i = 0; i < sizeof(URISchemes) / sizeof(URISchemes[0]); ++i) {
+
+        size_t length = ::strlen(URISchemes[i]);
+
+        if (uri.compare(0, length, URISchemes[i]) == 0) {
+            result.scheme = URISchemes[i];
+            position = length;
+            break;
+        }
     }
 
-    PathStyleParameterExpansionExpression pathStyleParameterExpansionExpression(expression);
-    if (pathStyleParameterExpansionExpression.IsExpressionType()) {
-        return pathSegmentExpansionExpression;
+    if (uri.compare(position, 3, "://") == 0)
+        position += 3;
+
+    size_t pathStart = uri.find('/', position);
+
+    if (pathStart == std::string::npos)
+        pathStart = uri.length();
+
+    result.host = uri.substr(position, pathStart - position);
+    result.path = uri.substr(pathStart);
+}
+
+/** Report illegal characters of a supported expression */
+static void CheckExpressionCharacters(const Expression& expression,
+                                      const mdp::CharactersRangeSet& sourceBlock,
+                                      Report& report)
+{
+    static const char* const AllowedCharacters = ". Allowed characters for expressions are A-Z a-z 0-9 _ and percent encoded characters";
+
+    bool hasIllegalCharacters = false;
+
+    if (expression.find(' ') != std::string::npos) {
+        std::stringstream ss;
+        ss << "URI template expression \"" << expression << "\" contains spaces" << AllowedCharacters;
+        report.warnings.push_back(Warning(ss.str(), URIWarning, sourceBlock));
+        hasIllegalCharacters = true;
     }
 
-    FormStyleQueryContinuationExpression formStyleQueryContinuationExpression(expression);
-    if (formStyleQueryContinuationExpression.IsExpressionType()) {
-        return formStyleQueryContinuationExpression;
+    if (expression.find('-') != std::string::npos) {
+        std::stringstream ss;
+        ss << "URI template expression \"" << expression << "\" contains hyphens" << AllowedCharacters;
+        report.warnings.push_back(Warning(ss.str(), URIWarning, sourceBlock));
+        hasIllegalCharacters = true;
     }
 
-    UndefinedExpression undefinedExpression(expression);
+    if (expression.find('=') != std::string::npos) {
+        std::stringstream ss;
+        ss << "URI template expression \"" << expression << "\" contains assignment" << AllowedCharacters;
+        report.warnings.push_back(Warning(ss.str(), URIWarning, sourceBlock));
+        hasIllegalCharacters = true;
+    }
 
-    return undefinedExpression;
+    if (!hasIllegalCharacters && IsInvalidExpressionName(expression)) {
+        std::stringstream ss;
+        ss << "URI template expression \"" << expression << "\" contains invalid characters" << AllowedCharacters;
+        report.warnings.push_back(Warning(ss.str(), URIWarning, sourceBlock));
+    }
 }
 
 void URITemplateParser::parse(const URITemplate& uri, const mdp::CharactersRangeSet& sourceBlock, ParsedURITemplate& result)
 {
-    CaptureGroups groups;
-    Expressions expressions;
-    size_t gSize=5;
-
     if (uri.empty()) return;
 
-    if (RegexCapture(uri, URI_REGEX, groups, gSize)) {
-        result.scheme = groups[1];
-        result.host = groups[3];
-        result.path = groups[4];
-
-        if (HasMismatchedCurlyBrackets(result.path)) {
-            result.report.warnings.push_back(Warning("The URI template contains mismatched expression brackets", URIWarning, sourceBlock));
-            return;
-        }
+    SplitURI(uri, result);
 
-        if (HasNestedCurlyBrackets(result.path)) {
-            result.report.warnings.push_back(Warning("The URI template contains nested expression brackets", URIWarning, sourceBlock));
-            return;
-        }
+    const std::string& path = result.path;
 
-        if (PathContainsSquareBrackets(result.path)) {
-            result.report.warnings.push_back(Warning("The URI template contains square brackets, please percent encode square brackets as %5B and %5D", URIWarning, sourceBlock));
-        }
+    // Scan brackets and expression boundaries in one pass
+    typedef std::pair<size_t, size_t> ExpressionSpan;
+    std::vector<ExpressionSpan> spans;
 
-        expressions = GetUriTemplateExpressions(result.path);
-
-        ExpressionIterator currentExpression = expressions.begin();
+    size_t openCount = 0;
+    size_t closeCount = 0;
+    char lastBracket = ' ';
+    bool hasNestedBrackets = false;
+    bool hasSquareBrackets = false;
+    size_t expressionStart = std::string::npos;
 
-        while (currentExpression != expressions.end()) {
+    for (size_t i = 0; i < path.length(); ++i) {
 
-            ClassifiedExpression classifiedExpression = ClassifyExpression(*currentExpression);
+        switch (path[i]) {
+            case '{':
+                ++openCount;
+                hasNestedBrackets |= (lastBracket == '{');
+                lastBracket = '{';
 
-            if (classifiedExpression.IsSupportedExpressionType()) {
-                bool hasIllegalCharacters = false;
+                if (expressionStart == std::string::npos)
+                    expressionStart = i + 1;
+                break;
 
-                if (classifiedExpression.ContainsSpaces()) {
-                    std::stringstream ss;
-                    ss << "URI template expression \"" << classifiedExpression.innerExpression << "\" contains spaces. Allowed characters for expressions are A-Z a-z 0-9 _ and percent encoded characters";
-                    result.report.warnings.push_back(Warning(ss.str(), URIWarning, sourceBlock));
-                    hasIllegalCharacters = true;
-                }
+            case '}':
+                ++closeCount;
+                hasNestedBrackets |= (lastBracket == '}');
+                lastBracket = '}';
 
-                if (classifiedExpression.ContainsHyphens()) {
-                    std::stringstream ss;
-                    ss << "URI template expression \"" << classifiedExpression.innerExpression << "\" contains hyphens. Allowed characters for expressions are A-Z a-z 0-9 _ and percent encoded characters";
-                    result.report.warnings.push_back(Warning(ss.str(), URIWarning, sourceBlock));
-                    hasIllegalCharacters = true;
+                if (expressionStart != std::string::npos) {
+                    spans.push_back(ExpressionSpan(expressionStart, i));
+                    expressionStart = std::string::npos;
                 }
+                break;
 
-                if (classifiedExpression.ContainsAssignment()) {
-                    std::stringstream ss;
-                    ss << "URI template expression \"" << classifiedExpression.innerExpression << "\" contains assignment. Allowed characters for expressions are A-Z a-z 0-9 _ and percent encoded characters";
-                    result.report.warnings.push_back(Warning(ss.str(), URIWarning, sourceBlock));
-                    hasIllegalCharacters = true;
-                }
+            case '[':
+            case ']':
+                hasSquareBrackets = true;
+                break;
 
-                if (!hasIllegalCharacters) {
-                    if (classifiedExpression.IsInvalidExpressionName()) {
-                        std::stringstream ss;
-                        ss << "URI template expression \"" << classifiedExpression.innerExpression << "\" contains invalid characters. Allowed characters for expressions are A-Z a-z 0-9 _ and percent encoded characters";
-                        result.report.warnings.push_back(Warning(ss.str(), URIWarning, sourceBlock));
-                    }
-                }
-            }
-            else{
-                result.report.warnings.push_back(Warning(classifiedExpression.unsupportedWarningText, URIWarning, sourceBlock));
-            }
-            currentExpression++;
+            default:
+                break;
         }
     }
-    else{
-        result.report.error = Error("Failed to parse URI Template", URIWarning);
+
+    // Unterminated expression spans the rest of the path
+    if (expressionStart != std::string::npos)
+        spans.push_back(ExpressionSpan(expressionStart, path.length()));
+
+    if (openCount != closeCount) {
+        result.report.warnings.push_back(Warning("The URI template contains mismatched expression brackets", URIWarning, sourceBlock));
+        return;
     }
 
-}
+    if (hasNestedBrackets) {
+        result.report.warnings.push_back(Warning("The URI template contains nested expression brackets", URIWarning, sourceBlock));
+        return;
+    }
+
+    if (hasSquareBrackets) {
+        result.report.warnings.push_back(Warning("The URI template contains square brackets, please percent encode square brackets as %5B and %5D", URIWarning, sourceBlock));
+    }
+
+    for (std::vector<ExpressionSpan>::const_iterator it = spans.begin(); it != spans.end(); ++it) {
+
+        ClassifiedExpression classifiedExpression = classifyExpression(path.substr(it->first, it->second - it->first));
 
+        if (classifiedExpression.IsSupportedExpressionType()) {
+            CheckExpressionCharacters(classifiedExpression.innerExpression, sourceBlock, result.report);
+        }
+        else {
+            result.report.warnings.push_back(Warning(classifiedExpression.UnsupportedWarningText(), URIWarning, sourceBlock));
+        }
+    }
+}
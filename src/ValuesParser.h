@@ -10,22 +10,17 @@
 #define SNOWCRASH_VALUESPARSER_H
 
 #include "SectionParser.h"
+#include "ParameterSignature.h"
 #include "RegexMatch.h"
 #include "StringUtility.h"
 
-/** Parameter Value regex */
-#define PARAMETER_VALUE "`([^`]+)`"
-
 namespace snowcrash {
 
-    /** Parameter Values matching regex */
-    const char* const ValuesRegex = "^[[:blank:]]*[Vv]alues[[:blank:]]*$";
-
     /**
      * Values section processor
      */
-    template<>
-    struct SectionProcessor<Values> : public SectionProcessorBase<Values> {
+    template<typename SourceMapPolicy>
+    struct SectionProcessor<Values, SourceMapPolicy> : public SectionProcessorBase<Values, SourceMapPolicy> {
 
         static MarkdownNodeIterator processNestedSection(const MarkdownNodeIterator& node,
                                                          const MarkdownNodes& siblings,
@@ -34,20 +29,19 @@ namespace snowcrash {
 
             if (pd.sectionContext() == ValueSectionType) {
 
-                mdp::ByteBuffer content = node->children().front().text;
-                CaptureGroups captureGroups;
-
-                RegexCapture(content, PARAMETER_VALUE, captureGroups);
+                const mdp::ByteBuffer& text = node->children().front().text;
+                Value value;
 
-                if (captureGroups.size() > 1) {
-                    out.node.push_back(captureGroups[1]);
+                if (ParseParameterValue(text, value)) {
+                    out.node.push_back(value);
 
-                    if (pd.exportSourceMap()) {
+                    if (SourceMapPolicy::exportSourceMap(pd)) {
                         SourceMap<Value> valueSM;
                         valueSM.sourceMap = node->sourceMap;
                         out.sourceMap.collection.push_back(valueSM);
                     }
                 } else {
+                    mdp::ByteBuffer content = text;
                     TrimString(content);
 
                     // WARN: Ignoring the unexpected param value
@@ -86,10 +80,9 @@ namespace snowcrash {
             if (node->type == mdp::ListItemMarkdownNodeType
                 && !node->children().empty()) {
 
-                mdp::ByteBuffer subject = node->children().front().text;
-                TrimString(subject);
+                StringView subject = TrimView(StringView(node->children().front().text));
 
-                if (RegexMatch(subject, ValuesRegex)) {
+                if (MatchSectionKeyword(subject, "Values")) {
                     return ValuesSectionType;
                 }
             }
@@ -102,8 +95,7 @@ namespace snowcrash {
             if (node->type == mdp::ListItemMarkdownNodeType
                 && !node->children().empty()) {
 
-                mdp::ByteBuffer subject = node->children().front().text;
-                TrimString(subject);
+                StringView subject = TrimView(StringView(node->children().front().text));
 
                 if (node->children().size() == 1 &&
                     !subject.empty()) {
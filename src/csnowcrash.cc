@@ -12,6 +12,11 @@
 using namespace snowcrash;
 
 int sc_c_parse(const char* source, sc_blueprint_parser_options option, sc_report_t** report, sc_blueprint_t** blueprint, sc_sm_blueprint_t** sm_blueprint)
+{
+    return sc_c_parse_instrumented(source, option, report, blueprint, sm_blueprint, NULL);
+}
+
+int sc_c_parse_instrumented(const char* source, sc_blueprint_parser_options option, sc_report_t** report, sc_blueprint_t** blueprint, sc_sm_blueprint_t** sm_blueprint, sc_parse_statistics_t* statistics)
 {
     Report* resultReport = ::new snowcrash::Report;
     Blueprint* resultblueprint = ::new snowcrash::Blueprint;
@@ -19,7 +24,30 @@ int sc_c_parse(const char* source, sc_blueprint_parser_options option, sc_report
 
     ParseResultRef<Blueprint> result(*resultReport, *resultblueprint, *resultSourceMap);
 
-    int ret = snowcrash::parse(source, option, result);
+    int ret = snowcrash::parse(source, option, result, AS_TYPE(ParseStatistics, statistics));
+
+    *report = AS_TYPE(sc_report_t, resultReport);
+    *blueprint = AS_TYPE(sc_blueprint_t, resultblueprint);
+    *sm_blueprint = AS_TYPE(sc_sm_blueprint_t, resultSourceMap);
+
+    return ret;
+}
+
+int sc_c_parse_cancellable(const char* source, sc_blueprint_parser_options option, const sc_cancellation_token_t* token, sc_report_t** report, sc_blueprint_t** blueprint, sc_sm_blueprint_t** sm_blueprint)
+{
+    Report* resultReport = ::new snowcrash::Report;
+    Blueprint* resultblueprint = ::new snowcrash::Blueprint;
+    SourceMap<snowcrash::Blueprint>* resultSourceMap = ::new SourceMap<snowcrash::Blueprint>;
+
+    ParseResultRef<Blueprint> result(*resultReport, *resultblueprint, *resultSourceMap);
+
+    int ret;
+    const CancellationToken* cancellation = AS_CTYPE(CancellationToken, token);
+
+    if (cancellation)
+        ret = snowcrash::parse(source, option, result, *cancellation);
+    else
+        ret = snowcrash::parse(source, option, result);
 
     *report = AS_TYPE(sc_report_t, resultReport);
     *blueprint = AS_TYPE(sc_blueprint_t, resultblueprint);
@@ -27,3 +55,132 @@ int sc_c_parse(const char* source, sc_blueprint_parser_options option, sc_report
 
     return ret;
 }
+
+/*----------------------------------------------------------------------*/
+
+struct sc_parse_result_s {
+    ParseResult<Blueprint> result;
+};
+
+int sc_c_parse_v2(const char* source, size_t length, sc_blueprint_parser_options option, sc_parse_result_t** result, const sc_report_t** report, const sc_blueprint_t** blueprint, const sc_sm_blueprint_t** sm_blueprint)
+{
+    if (report)
+        *report = NULL;
+
+    if (blueprint)
+        *blueprint = NULL;
+
+    if (sm_blueprint)
+        *sm_blueprint = NULL;
+
+    // Nothing would own the artifacts
+    if (!result)
+        return ApplicationError;
+
+    sc_parse_result_t* parseResult = ::new sc_parse_result_t;
+
+    if (sm_blueprint)
+        option |= ExportSourcemapOption;
+    else
+        option &= ~ExportSourcemapOption;
+
+    mdp::ByteBuffer sourceData;
+
+    if (source)
+        sourceData.assign(source, length);
+
+    int ret = snowcrash::parse(sourceData, option, parseResult->result);
+
+    *result = parseResult;
+
+    if (report)
+        *report = AS_CTYPE(sc_report_t, &parseResult->result.report);
+
+    if (blueprint)
+        *blueprint = AS_CTYPE(sc_blueprint_t, &parseResult->result.node);
+
+    if (sm_blueprint)
+        *sm_blueprint = AS_CTYPE(sc_sm_blueprint_t, &parseResult->result.sourceMap);
+
+    return ret;
+}
+
+SC_API void sc_parse_result_free(sc_parse_result_t* result)
+{
+    ::delete result;
+}
+
+SC_API const sc_report_t* sc_parse_result_report(const sc_parse_result_t* result)
+{
+    if (!result)
+        return NULL;
+
+    return AS_CTYPE(sc_report_t, &result->result.report);
+}
+
+SC_API const sc_blueprint_t* sc_parse_result_blueprint(const sc_parse_result_t* result)
+{
+    if (!result)
+        return NULL;
+
+    return AS_CTYPE(sc_blueprint_t, &result->result.node);
+}
+
+SC_API const sc_sm_blueprint_t* sc_parse_result_sm_blueprint(const sc_parse_result_t* result)
+{
+    if (!result)
+        return NULL;
+
+    return AS_CTYPE(sc_sm_blueprint_t, &result->result.sourceMap);
+}
+
+/*----------------------------------------------------------------------*/
+
+struct sc_parser_s {
+    Parser parser;
+    mdp::ByteBuffer source;
+    ParseResult<Blueprint> result;
+};
+
+SC_API sc_parser_t* sc_parser_new()
+{
+    return ::new sc_parser_t;
+}
+
+SC_API void sc_parser_free(sc_parser_t* parser)
+{
+    ::delete parser;
+}
+
+int sc_parser_parse(sc_parser_t* parser, const char* source, sc_blueprint_parser_options option, const sc_cancellation_token_t* token, const sc_report_t** report, const sc_blueprint_t** blueprint, const sc_sm_blueprint_t** sm_blueprint)
+{
+    if (report)
+        *report = NULL;
+
+    if (blueprint)
+        *blueprint = NULL;
+
+    if (sm_blueprint)
+        *sm_blueprint = NULL;
+
+    if (!parser)
+        return ApplicationError;
+
+    if (source)
+        parser->source.assign(source);
+    else
+        parser->source.clear();
+
+    int ret = parser->parser.parse(parser->source, option, parser->result, AS_CTYPE(CancellationToken, token));
+
+    if (report)
+        *report = AS_CTYPE(sc_report_t, &parser->result.report);
+
+    if (blueprint)
+        *blueprint = AS_CTYPE(sc_blueprint_t, &parser->result.node);
+
+    if (sm_blueprint)
+        *sm_blueprint = AS_CTYPE(sc_sm_blueprint_t, &parser->result.sourceMap);
+
+    return ret;
+}
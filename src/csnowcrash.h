@@ -13,6 +13,9 @@
 #include "CSourceAnnotation.h"
 #include "CBlueprint.h"
 #include "CBlueprintSourcemap.h"
+#include "CCancellationToken.h"
+#include "CParseStatistics.h"
+#include "CRouteIndex.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -33,6 +36,97 @@ extern "C" {
      */
     SC_API int sc_c_parse(const char* source, sc_blueprint_parser_options option, sc_report_t** report, sc_blueprint_t** blueprint, sc_sm_blueprint_t** sm_blueprint);
 
+    /**
+     *  \brief C interface for snowcrash parser collecting instrumentation statistics.
+     *
+     *  Same as `sc_c_parse`, in addition data collected during parsing is added to `statistics`.
+     *  Statistics are only collected if the library was built with instrumentation.
+     *
+     *  \param statistics    statistics allocated by `sc_parse_statistics_new`, NULL to collect none.
+     */
+    SC_API int sc_c_parse_instrumented(const char* source, sc_blueprint_parser_options option, sc_report_t** report, sc_blueprint_t** blueprint, sc_sm_blueprint_t** sm_blueprint, sc_parse_statistics_t* statistics);
+
+
+    /**
+     *  \brief C interface for snowcrash parser with cooperative cancellation.
+     *
+     *  Same as `sc_c_parse`. Parsing stops at the next Markdown node boundary once `token`
+     *  is cancelled or its deadline passes, returning `SC_CANCELLED_ERROR` or
+     *  `SC_DEADLINE_EXCEEDED_ERROR`. The report then holds warnings found so far.
+     *
+     *  \param token         cancellation token allocated by `sc_cancellation_token_new`.
+     */
+    SC_API int sc_c_parse_cancellable(const char* source, sc_blueprint_parser_options option, const sc_cancellation_token_t* token, sc_report_t** report, sc_blueprint_t** blueprint, sc_sm_blueprint_t** sm_blueprint);
+
+    /*----------------------------------------------------------------------*/
+
+    /** Class parse result wrapper, owns the report, blueprint AST and source map of a parse */
+    struct sc_parse_result_s;
+    typedef struct sc_parse_result_s sc_parse_result_t;
+
+    /**
+     *  \brief C interface for snowcrash parser, single allocation.
+     *
+     *  \param source        A textual source data to be parsed, need not be NUL-terminated.
+     *  \param length        Length of the source data.
+     *  \param options       Parser options. Use 0 for no addtional options.
+     *  \param result        returns the pointer to parse result owning all of the artifacts, required.
+     *  \param report        returns the pointer to report, NULL if not wanted.
+     *  \param blueprint     returns the pointer to blueprint AST, NULL if not wanted.
+     *  \param sm_blueprint  returns the pointer to blueprint source map, NULL if not wanted.
+     *
+     *  \return Error status code. Zero represents success, non-zero a failure.
+     *
+     *  The source map is exported only if `sm_blueprint` is not NULL, regardless of
+     *  `SC_EXPORT_SORUCEMAP_OPTION`. Returned artifacts are valid until `sc_parse_result_free`
+     *  is called on `result`, they must not be freed on their own. If `result` is NULL
+     *  nothing is parsed, the other outputs are set to NULL and a non-zero code is returned.
+     */
+    SC_API int sc_c_parse_v2(const char* source, size_t length, sc_blueprint_parser_options option, sc_parse_result_t** result, const sc_report_t** report, const sc_blueprint_t** blueprint, const sc_sm_blueprint_t** sm_blueprint);
+
+    /** \deallocate parse result and all of its artifacts from pointer*/
+    SC_API void sc_parse_result_free(sc_parse_result_t* result);
+
+    /** \returns report of the parse result*/
+    SC_API const sc_report_t* sc_parse_result_report(const sc_parse_result_t* result);
+
+    /** \returns blueprint AST of the parse result*/
+    SC_API const sc_blueprint_t* sc_parse_result_blueprint(const sc_parse_result_t* result);
+
+    /** \returns blueprint source map of the parse result, empty if not exported*/
+    SC_API const sc_sm_blueprint_t* sc_parse_result_sm_blueprint(const sc_parse_result_t* result);
+
+    /*----------------------------------------------------------------------*/
+
+    /** Class Parser wrapper */
+    struct sc_parser_s;
+    typedef struct sc_parser_s sc_parser_t;
+
+    /** \returns pointer to allocated reusable Parser, not to be used by more threads at once*/
+    SC_API sc_parser_t* sc_parser_new();
+
+    /** \deallocate Parser from pointer*/
+    SC_API void sc_parser_free(sc_parser_t* parser);
+
+    /**
+     *  \brief C interface for the reusable snowcrash parser.
+     *
+     *  Same as `sc_c_parse_cancellable`, except the results are owned by the parser.
+     *  They stay valid until the next parse with the same parser or until `sc_parser_free`,
+     *  and must not be freed by the caller. The parser keeps its scratch state and the
+     *  capacity of the results between calls, see `snowcrash::Parser`.
+     *
+     *  \param parser        parser allocated by `sc_parser_new`.
+     *  \param token         cancellation token allocated by `sc_cancellation_token_new`, NULL if not cancellable.
+     *  \param report        returns the pointer to report, NULL if not wanted.
+     *  \param blueprint     returns the pointer to blueprint AST, NULL if not wanted.
+     *  \param sm_blueprint  returns the pointer to blueprint source map, NULL if not wanted.
+     *
+     *  If `parser` is NULL nothing is parsed, the outputs are set to NULL and a non-zero
+     *  code is returned.
+     */
+    SC_API int sc_parser_parse(sc_parser_t* parser, const char* source, sc_blueprint_parser_options option, const sc_cancellation_token_t* token, const sc_report_t** report, const sc_blueprint_t** blueprint, const sc_sm_blueprint_t** sm_blueprint);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,62 @@
+//
+//  CancellationToken.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#if defined(__APPLE__)
+#include <mach/mach_time.h>
+#else
+#include <time.h>
+#endif
+
+#include "CancellationToken.h"
+
+using namespace snowcrash;
+
+/** \returns Monotonic time in milliseconds, unaffected by changes of the wall clock */
+static double Milliseconds()
+{
+#if defined(__APPLE__)
+    mach_timebase_info_data_t timebase;
+    ::mach_timebase_info(&timebase);
+
+    return (::mach_absolute_time() * static_cast<double>(timebase.numer) / timebase.denom) / 1000000.0;
+#else
+    struct timespec time;
+    ::clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return time.tv_sec * 1000.0 + time.tv_nsec / 1000000.0;
+#endif
+}
+
+void CancellationToken::cancel()
+{
+    __atomic_store_n(&m_cancelled, 1, __ATOMIC_RELEASE);
+}
+
+bool CancellationToken::isCancelled() const
+{
+    return __atomic_load_n(&m_cancelled, __ATOMIC_ACQUIRE) != 0;
+}
+
+void CancellationToken::setTimeout(unsigned int milliseconds)
+{
+    m_deadline = (milliseconds) ? Milliseconds() + milliseconds : 0;
+}
+
+bool CancellationToken::isExpired() const
+{
+    return m_deadline != 0 && Milliseconds() >= m_deadline;
+}
+
+void CancellationToken::check() const
+{
+    if (isCancelled())
+        throw CancellationException("parsing has been cancelled", CancelledError);
+
+    if (isExpired())
+        throw CancellationException("parsing deadline has been exceeded", DeadlineExceededError);
+}
@@ -0,0 +1,77 @@
+//
+//  ParallelFor.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <pthread.h>
+#include <vector>
+#include "ParallelFor.h"
+
+using namespace snowcrash;
+
+namespace {
+
+    // Work shared by the threads of one ParallelFor
+    struct ParallelWork {
+        size_t count;
+        size_t next;
+        ParallelTask task;
+        void* context;
+        pthread_mutex_t mutex;
+    };
+
+    void* ParallelWorker(void* data)
+    {
+        ParallelWork* work = static_cast<ParallelWork*>(data);
+
+        for (;;) {
+            ::pthread_mutex_lock(&work->mutex);
+            size_t index = work->next++;
+            ::pthread_mutex_unlock(&work->mutex);
+
+            if (index >= work->count)
+                return NULL;
+
+            work->task(index, work->context);
+        }
+    }
+}
+
+void snowcrash::ParallelFor(size_t count, size_t threads, ParallelTask task, void* context)
+{
+    if (threads > count)
+        threads = count;
+
+    if (threads <= 1) {
+        for (size_t i = 0; i < count; ++i)
+            task(i, context);
+
+        return;
+    }
+
+    ParallelWork work;
+    work.count = count;
+    work.next = 0;
+    work.task = task;
+    work.context = context;
+    ::pthread_mutex_init(&work.mutex, NULL);
+
+    // The calling thread is one of the workers
+    std::vector<pthread_t> workers(threads - 1);
+    size_t started = 0;
+
+    for (; started < workers.size(); ++started) {
+        if (::pthread_create(&workers[started], NULL, ParallelWorker, &work) != 0)
+            break;
+    }
+
+    ParallelWorker(&work);
+
+    for (size_t i = 0; i < started; ++i)
+        ::pthread_join(workers[i], NULL);
+
+    ::pthread_mutex_destroy(&work.mutex);
+}
@@ -8,7 +8,101 @@
 
 #include <regex.h>
 #include <cstring>
+#include <map>
 #include "RegexMatch.h"
+#include "ParseStatistics.h"
+
+using namespace snowcrash;
+
+/** Expressions compiled once per cache, NULL if an expression does not compile */
+struct RegexCache::Expressions {
+
+    typedef std::map<std::string, regex_t*> Compiled;
+
+    /** Compiled with REG_NOSUB */
+    Compiled match;
+
+    /** Compiled with capture groups */
+    Compiled capture;
+};
+
+/** Regex cache used by the current thread */
+static SC_THREAD_LOCAL RegexCache* ActiveCache = NULL;
+
+RegexCache::RegexCache()
+: m_expressions(new Expressions)
+{
+}
+
+RegexCache::~RegexCache()
+{
+    clear();
+    delete m_expressions;
+}
+
+static void FreeCompiled(RegexCache::Expressions::Compiled& compiled)
+{
+    for (RegexCache::Expressions::Compiled::iterator it = compiled.begin(); it != compiled.end(); ++it) {
+        if (it->second) {
+            ::regfree(it->second);
+            delete it->second;
+        }
+    }
+
+    compiled.clear();
+}
+
+void RegexCache::clear()
+{
+    FreeCompiled(m_expressions->match);
+    FreeCompiled(m_expressions->capture);
+}
+
+RegexCache* RegexCache::active()
+{
+    return ActiveCache;
+}
+
+void RegexCache::setActive(RegexCache* cache)
+{
+    ActiveCache = cache;
+}
+
+/**
+ *  \brief Compile an expression, or take it from the active cache
+ *  \param local   Storage to compile into without an active cache
+ *  \return Compiled expression, NULL if it does not compile
+ */
+static regex_t* CompileRegex(const std::string& expression, int flags, regex_t& local)
+{
+    RegexCache* cache = RegexCache::active();
+
+    if (!cache)
+        return ::regcomp(&local, expression.c_str(), flags) ? NULL : &local;
+
+    RegexCache::Expressions::Compiled& compiled = (flags & REG_NOSUB) ? cache->expressions().match : cache->expressions().capture;
+    RegexCache::Expressions::Compiled::iterator it = compiled.find(expression);
+
+    if (it != compiled.end())
+        return it->second;
+
+    regex_t* regex = new regex_t;
+
+    if (::regcomp(regex, expression.c_str(), flags)) {
+        delete regex;
+        regex = NULL;
+    }
+
+    compiled[expression] = regex;
+    return regex;
+}
+
+/** Free an expression compiled by CompileRegex() unless it is cached */
+static void ReleaseRegex(regex_t* regex, regex_t& local)
+{
+    if (regex == &local)
+        ::regfree(&local);
+}
 
 // FIXME: Migrate to C++11.
 // Naive implementation of regex matching using POSIX regex
@@ -17,31 +111,20 @@ bool snowcrash::RegexMatch(const std::string& target, const std::string& express
     if (target.empty() || expression.empty())
         return false;
 
-    regex_t regex;
-    int reti = ::regcomp(&regex, expression.c_str(), REG_EXTENDED | REG_NOSUB);
-    if (reti) {
+    SC_INSTRUMENT_REGEX(expression);
+
+    regex_t local;
+    regex_t* regex = CompileRegex(expression, REG_EXTENDED | REG_NOSUB, local);
+    if (!regex) {
         // Unable to compile regex
         return false;
     }
     
     // Execute regular expression
-    reti = ::regexec(&regex, target.c_str(), 0, NULL, 0);
-    if (!reti) {
-        ::regfree(&regex);
-        return true;
-    }
-    else if (reti == REG_NOMATCH) {
-        ::regfree(&regex);
-        return false;
-    }
-    else {
-        char msgbuf[1024];
-        regerror(reti, &regex, msgbuf, sizeof(msgbuf));
-        ::regfree(&regex);
-        return false;
-    }
-    
-    return false;
+    int reti = ::regexec(regex, target.c_str(), 0, NULL, 0);
+    ReleaseRegex(regex, local);
+
+    return reti == 0;
 }
 
 std::string snowcrash::RegexCaptureFirst(const std::string& target, const std::string& expression)
@@ -58,22 +141,24 @@ bool snowcrash::RegexCapture(const std::string& target, const std::string& expre
 {
     if (target.empty() || expression.empty())
         return false;
+
+    SC_INSTRUMENT_REGEX(expression);
     
     captureGroups.clear();
     
     try {
-        regex_t regex;
-        int reti = ::regcomp(&regex, expression.c_str(), REG_EXTENDED);
-        if (reti)
+        regex_t local;
+        regex_t* regex = CompileRegex(expression, REG_EXTENDED, local);
+        if (!regex)
             return false;
         
         regmatch_t *pmatch = ::new regmatch_t[groupSize];
         ::memset(pmatch, 0, sizeof(regmatch_t) * groupSize);
         
-        reti = ::regexec(&regex, target.c_str(), groupSize, pmatch, 0);
+        int reti = ::regexec(regex, target.c_str(), groupSize, pmatch, 0);
+        ReleaseRegex(regex, local);
+
         if (!reti) {
-            ::regfree(&regex);
-            
             for (size_t i = 0; i < groupSize; ++i) {
                 if (pmatch[i].rm_so == -1 || pmatch[i].rm_eo == -1)
                     captureGroups.push_back(std::string());
@@ -85,7 +170,6 @@ bool snowcrash::RegexCapture(const std::string& target, const std::string& expre
             return true;
         }
         else {
-            ::regfree(&regex);
             delete [] pmatch;        
             return false;
         }
@@ -47,11 +47,168 @@ static bool CheckSource(const mdp::ByteBuffer& source, Report& report)
     return true;
 }
 
-int snowcrash::parse(const mdp::ByteBuffer& source,
-                     BlueprintParserOptions options,
-                     const ParseResultRef<Blueprint>& out)
+/** Add warnings of a report to warning counters */
+static void CountWarnings(const Report& report, ParseStatistics* statistics)
+{
+    if (!statistics)
+        return;
+
+    for (Warnings::const_iterator it = report.warnings.begin(); it != report.warnings.end(); ++it) {
+        ++statistics->warnings[it->code];
+    }
+}
+
+struct snowcrash::Parser::Scratch {
+
+    /** Markdown parser */
+    mdp::MarkdownParser markdownParser;
+
+    /** Sections stack, kept for its capacity */
+    SectionParserData::SectionsStack sectionsContext;
+
+    /** Symbol tables */
+    SymbolTable symbolTable;
+    SymbolSourceMapTable symbolSourceMapTable;
+
+    /** Compiled regular expressions */
+    RegexCache regexCache;
+};
+
+/** Lends the scratch containers to parser data for the duration of a parse */
+class ScratchLoan {
+public:
+    ScratchLoan(Parser::Scratch& scratch, SectionParserData& pd)
+    : m_scratch(scratch), m_pd(pd) {
+        swap();
+        m_pd.sectionsContext.clear();
+        m_pd.symbolTable.resourceModels.clear();
+        m_pd.symbolSourceMapTable.resourceModels.clear();
+    }
+
+    ~ScratchLoan() {
+        swap();
+    }
+
+private:
+    Parser::Scratch& m_scratch;
+    SectionParserData& m_pd;
+
+    void swap() {
+        m_pd.sectionsContext.swap(m_scratch.sectionsContext);
+        m_pd.symbolTable.resourceModels.swap(m_scratch.symbolTable.resourceModels);
+        m_pd.symbolSourceMapTable.resourceModels.swap(m_scratch.symbolSourceMapTable.resourceModels);
+    }
+};
+
+/** Empty a parse result keeping the capacity of its top-level collections */
+static void ClearResult(const ParseResultRef<Blueprint>& out)
+{
+    out.report.error = Error();
+    out.report.warnings.clear();
+
+    out.node.metadata.clear();
+    out.node.name.clear();
+    out.node.description.clear();
+    out.node.resourceGroups.clear();
+    out.node.dataStructures.description.clear();
+    out.node.dataStructures.dataStructures.clear();
+
+    out.sourceMap.sourceMap.clear();
+    out.sourceMap.metadata.collection.clear();
+    out.sourceMap.name.sourceMap.clear();
+    out.sourceMap.description.sourceMap.clear();
+    out.sourceMap.resourceGroups.collection.clear();
+    out.sourceMap.dataStructures.sourceMap.clear();
+    out.sourceMap.dataStructures.description.sourceMap.clear();
+    out.sourceMap.dataStructures.dataStructures.collection.clear();
+}
+
+/** Forwards events, delivering the warnings reported since the previous event first */
+class WarningForwardingEvents : public BlueprintEvents {
+public:
+    WarningForwardingEvents(const Report& report, BlueprintEvents& events)
+    : m_report(report), m_events(events), m_forwarded(0) {}
+
+    /** Deliver the warnings reported since the previous event */
+    void flush() {
+        for (; m_forwarded < m_report.warnings.size(); ++m_forwarded) {
+            m_events.warning(m_report.warnings[m_forwarded]);
+        }
+    }
+
+    virtual void resourceGroupStart(const ResourceGroup& group) {
+        flush();
+        m_events.resourceGroupStart(group);
+    }
+
+    virtual void resourceGroupEnd(const ResourceGroup& group) {
+        flush();
+        m_events.resourceGroupEnd(group);
+    }
+
+    virtual void resourceStart(const Resource& resource) {
+        flush();
+        m_events.resourceStart(resource);
+    }
+
+    virtual void resourceEnd(const Resource& resource) {
+        flush();
+        m_events.resourceEnd(resource);
+    }
+
+    virtual void action(const Action& action) {
+        flush();
+        m_events.action(action);
+    }
+
+    virtual void payload(const Payload& payload, SectionType type) {
+        flush();
+        m_events.payload(payload, type);
+    }
+
+    virtual void parameter(const Parameter& parameter) {
+        flush();
+        m_events.parameter(parameter);
+    }
+
+    virtual void error(const Error& error) {
+        flush();
+        m_events.error(error);
+    }
+
+private:
+    const Report& m_report;
+    BlueprintEvents& m_events;
+    size_t m_forwarded;
+};
+
+/**
+ *  \brief Parse blueprint
+ *  \param cancellation Token to check at node boundaries, NULL if not cancellable
+ *  \param statistics   Statistics to collect, NULL to collect none
+ *  \param scratch      Markdown parser, containers and regex cache to use, kept by reusable parsers
+ *  \param events       Events to emit as entities are completed, NULL to emit none
+ */
+static int ParseBlueprint(const mdp::ByteBuffer& source,
+                          BlueprintParserOptions options,
+                          const ParseResultRef<Blueprint>& out,
+                          const CancellationToken* cancellation,
+                          ParseStatistics* statistics,
+                          Parser::Scratch& scratch,
+                          BlueprintEvents* events = NULL)
 {
+#ifndef SNOWCRASH_INSTRUMENTATION
+    statistics = NULL;
+#endif
+
+    ActiveParseStatistics activeStatistics(statistics);
+    ActiveRegexCache activeRegexCache(scratch.regexCache);
+
+    PayloadSignatureCache payloadSignatures;
+    ActivePayloadSignatureCache activePayloadSignatures(payloadSignatures);
+
     try {
+        SC_INSTRUMENT_SCOPE(statistics, "snowcrash::parse");
 
         // Sanity Check
         if (!CheckSource(source, out.report))
@@ -61,16 +218,34 @@ int snowcrash::parse(const mdp::ByteBuffer& source,
         if (source.empty())
             return out.report.error.code;
 
+        if (cancellation)
+            cancellation->check();
+
         // Parse Markdown
-        mdp::MarkdownParser markdownParser;
         mdp::MarkdownNode markdownAST;
-        markdownParser.parse(source, markdownAST);
+        {
+            SC_INSTRUMENT_SCOPE(statistics, "mdp::MarkdownParser::parse");
+            scratch.markdownParser.parse(source, markdownAST);
+        }
 
         // Build SectionParserData
         SectionParserData pd(options, source, out.node);
+        pd.statistics = statistics;
+        pd.cancellation = cancellation;
+        pd.events = events;
+
+        ScratchLoan loan(scratch, pd);
 
         // Parse Blueprint
-        BlueprintParser::parse(markdownAST.children().begin(), markdownAST.children(), pd, out);
+        if (pd.exportSourceMap())
+            SourceMapBlueprintParser::parse(markdownAST.children().begin(), markdownAST.children(), pd, out);
+        else
+            NoSourceMapBlueprintParser::parse(markdownAST.children().begin(), markdownAST.children(), pd, out);
+    }
+    catch (const CancellationException& e) {
+
+        // Keep warnings reported so far
+        out.report.error = Error(e.what(), e.code);
     }
     catch (const std::exception& e) {
 
@@ -83,5 +258,74 @@ int snowcrash::parse(const mdp::ByteBuffer& source,
         out.report.error = Error("parser exception has occured", 1);
     }
 
+    CountWarnings(out.report, statistics);
+
     return out.report.error.code;
 }
+
+int snowcrash::parse(const mdp::ByteBuffer& source,
+                     BlueprintParserOptions options,
+                     const ParseResultRef<Blueprint>& out)
+{
+    Parser::Scratch scratch;
+    return ParseBlueprint(source, options, out, NULL, NULL, scratch);
+}
+
+int snowcrash::parse(const mdp::ByteBuffer& source,
+                     BlueprintParserOptions options,
+                     const ParseResultRef<Blueprint>& out,
+                     ParseStatistics* statistics)
+{
+    Parser::Scratch scratch;
+    return ParseBlueprint(source, options, out, NULL, statistics, scratch);
+}
+
+int snowcrash::parse(const mdp::ByteBuffer& source,
+                     BlueprintParserOptions options,
+                     const ParseResultRef<Blueprint>& out,
+                     const CancellationToken& cancellation,
+                     ParseStatistics* statistics)
+{
+    Parser::Scratch scratch;
+    return ParseBlueprint(source, options, out, &cancellation, statistics, scratch);
+}
+
+int snowcrash::parse(const mdp::ByteBuffer& source,
+                     BlueprintParserOptions options,
+                     BlueprintEvents& events)
+{
+    // Keeps only a summary of the reported entities, see SectionParserData::events
+    ParseResult<Blueprint> blueprint;
+    Parser::Scratch scratch;
+
+    WarningForwardingEvents forwarding(blueprint.report, events);
+
+    int result = ParseBlueprint(source, options & ~ExportSourcemapOption, blueprint, NULL, NULL, scratch, &forwarding);
+
+    forwarding.flush();
+
+    if (result != Error::OK)
+        forwarding.error(blueprint.report.error);
+
+    return result;
+}
+
+snowcrash::Parser::Parser()
+: m_scratch(new Scratch)
+{
+}
+
+snowcrash::Parser::~Parser()
+{
+    delete m_scratch;
+}
+
+int snowcrash::Parser::parse(const mdp::ByteBuffer& source,
+                             BlueprintParserOptions options,
+                             const ParseResultRef<Blueprint>& out,
+                             const CancellationToken* cancellation,
+                             ParseStatistics* statistics)
+{
+    ClearResult(out);
+    return ParseBlueprint(source, options, out, cancellation, statistics, *m_scratch);
+}
@@ -9,6 +9,7 @@
 #ifndef SNOWCRASH_H
 #define SNOWCRASH_H
 
+#include "BlueprintEvents.h"
 #include "BlueprintSourcemap.h"
 #include "SourceAnnotation.h"
 #include "SectionParser.h"
@@ -24,6 +25,23 @@
  *  For binding writers, this is the point to start wrapping.
  *  Refer to https://github.com/apiaryio/snowcrash/wiki/Writing-a-binding
  *  for details on how to write a Snow Crash binding.
+ *
+ *  Thread Safety
+ *  -------------
+ *
+ *  The parser is reentrant. The `parse()` functions may be called from any
+ *  number of threads at once provided every call has its own output, events
+ *  and statistics. The library keeps no mutable state shared between the
+ *  calls, its only globals are constants initialized before `main()`.
+ *  A `CancellationToken` may be shared by the calls and cancelled from any
+ *  thread. A `Parser` and its C counterpart keep their scratch state
+ *  between the calls and must be used by one thread at a time.
+ *
+ *  New shared state, e.g. caches, must keep this contract: no function-local
+ *  statics (their initialization isn't thread-safe on every toolchain this
+ *  library builds with) and synchronized access to anything mutable. The
+ *  `[concurrency]` tests exercise the contract, run them under
+ *  ThreadSanitizer with `make test-tsan`.
  */
 
 namespace snowcrash {
@@ -39,6 +57,104 @@ namespace snowcrash {
     int parse(const mdp::ByteBuffer& source,
               BlueprintParserOptions options,
               const ParseResultRef<Blueprint>& out);
+
+    /**
+     *  \brief Parse the source data collecting instrumentation statistics.
+     *
+     *  Statistics are only collected if the library was built with instrumentation,
+     *  refer to ParseStatistics.h. Collected data is added to \p statistics.
+     *
+     *  \param source       A textual source data to be parsed.
+     *  \param options      Parser options. Use 0 for no additional options.
+     *  \param out          Output buffer to store parsing result into.
+     *  \param statistics   Statistics to add collected data to, NULL to collect none.
+     *  \return Error status code. Zero represents success, non-zero a failure.
+     */
+    int parse(const mdp::ByteBuffer& source,
+              BlueprintParserOptions options,
+              const ParseResultRef<Blueprint>& out,
+              ParseStatistics* statistics);
+
+    /**
+     *  \brief Parse the source data with cooperative cancellation.
+     *
+     *  The token is checked at Markdown node boundaries. Once it is cancelled or its
+     *  deadline passes, parsing stops and the report error is set to CancelledError or
+     *  DeadlineExceededError. Warnings reported up to that point are kept.
+     *
+     *  \param source       A textual source data to be parsed.
+     *  \param options      Parser options. Use 0 for no additional options.
+     *  \param out          Output buffer to store parsing result into.
+     *  \param cancellation Cancellation token to check.
+     *  \param statistics   Statistics to add collected data to, NULL to collect none.
+     *  \return Error status code. Zero represents success, non-zero a failure.
+     */
+    int parse(const mdp::ByteBuffer& source,
+              BlueprintParserOptions options,
+              const ParseResultRef<Blueprint>& out,
+              const CancellationToken& cancellation,
+              ParseStatistics* statistics = NULL);
+
+    /**
+     *  \brief Parse the source data emitting events instead of returning the AST.
+     *
+     *  Entities are reported to \p events as they are completed, see %BlueprintEvents.
+     *  The blueprint is not assembled, only a summary of the reported resources is kept
+     *  for the duplicate checks and the references resolved at the end. Source maps are
+     *  never built. Warnings are emitted as they are reported, the error comes last.
+     *
+     *  \param source       A textual source data to be parsed.
+     *  \param options      Parser options. Use 0 for no additional options.
+     *  \param events       Receiver of the parsing events.
+     *  \return Error status code. Zero represents success, non-zero a failure.
+     */
+    int parse(const mdp::ByteBuffer& source,
+              BlueprintParserOptions options,
+              BlueprintEvents& events);
+
+    /**
+     *  \brief Reusable blueprint parser.
+     *
+     *  Produces the same results as `parse()`. Kept between calls are the
+     *  Markdown parser, the section context stack, the symbol tables and
+     *  the compiled regular expressions. The output is emptied in place
+     *  before parsing, pass the same result to every call to keep the
+     *  capacity of its report and top-level collections. The Markdown AST
+     *  and the nested AST collections are still built for every parse, and
+     *  the symbol tables are maps that free their entries when emptied.
+     *  `make perf-warm` measures the gains. A parser must not be used from
+     *  more than one thread at a time, use one parser per thread.
+     */
+    class Parser {
+    public:
+        Parser();
+        ~Parser();
+
+        /**
+         *  \brief Parse the source data into a blueprint abstract source tree (AST).
+         *
+         *  \param source       A textual source data to be parsed.
+         *  \param options      Parser options. Use 0 for no additional options.
+         *  \param out          Output buffer to store parsing result into, emptied first.
+         *  \param cancellation Cancellation token to check, NULL if not cancellable.
+         *  \param statistics   Statistics to add collected data to, NULL to collect none.
+         *  \return Error status code. Zero represents success, non-zero a failure.
+         */
+        int parse(const mdp::ByteBuffer& source,
+                  BlueprintParserOptions options,
+                  const ParseResultRef<Blueprint>& out,
+                  const CancellationToken* cancellation = NULL,
+                  ParseStatistics* statistics = NULL);
+
+        /** Markdown parser, containers and regex cache kept between the parses */
+        struct Scratch;
+
+    private:
+        Scratch* m_scratch;
+
+        Parser(const Parser&);
+        Parser& operator=(const Parser&);
+    };
 }
 
 #endif
@@ -14,6 +14,8 @@
 #include "SerializeYAML.h"
 #include "cmdline.h"
 #include "Version.h"
+#include "StringUtility.h"
+#include "ParallelFor.h"
 
 using snowcrash::SourceAnnotation;
 using snowcrash::Error;
@@ -24,6 +26,11 @@ static const std::string RenderArgument = "render";
 static const std::string SourcemapArgument = "sourcemap";
 static const std::string ValidateArgument = "validate";
 static const std::string VersionArgument = "version";
+static const std::string StatsArgument = "stats";
+static const std::string TraceArgument = "trace";
+static const std::string SkipArgument = "skip";
+static const std::string JobsArgument = "jobs";
+static const std::string SourcemapEncodingArgument = "sourcemap-encoding";
 
 /// \enum Snow Crash AST output format.
 enum SerializationFormat {
@@ -31,6 +38,76 @@ enum SerializationFormat {
     JSONSerializationFormat
 };
 
+/// \brief Artifact written by the CLI, the AST or its source map.
+struct OutputArtifact {
+    const snowcrash::ParseResult<snowcrash::Blueprint>* blueprint;
+    SerializationFormat format;
+    bool sourceMap;
+    size_t jobs;
+    std::ostream* os;
+
+    /// \brief Serialize the artifact at \p index of an artifact array into its destination.
+    static void serialize(size_t index, void* context)
+    {
+        const OutputArtifact& artifact = static_cast<const OutputArtifact*>(context)[index];
+
+        if (artifact.format == JSONSerializationFormat) {
+            if (artifact.sourceMap)
+                snowcrash::SerializeSourceMapJSON(artifact.blueprint->sourceMap, *artifact.os, artifact.jobs);
+            else
+                snowcrash::SerializeJSON(artifact.blueprint->node, *artifact.os, artifact.jobs);
+        }
+        else {
+            if (artifact.sourceMap)
+                snowcrash::SerializeSourceMapYAML(artifact.blueprint->sourceMap, *artifact.os, artifact.jobs);
+            else
+                snowcrash::SerializeYAML(artifact.blueprint->node, *artifact.os, artifact.jobs);
+        }
+
+        artifact.os->flush();
+    }
+};
+
+/// \brief Open an output file, exit on failure.
+static void OpenOutputFile(const std::string& fileName, std::ofstream& stream)
+{
+    stream.open(fileName.c_str());
+
+    if (!stream.is_open()) {
+        std::cerr << "fatal: unable to write to file '" << fileName << "'\n";
+        exit(EXIT_FAILURE);
+    }
+}
+
+/// \brief Translate the `--skip` argument into parser options.
+/// \param value Comma-separated list of the content to skip
+/// \param options Parser options to update
+/// \return False if the list contains an unknown content
+static bool ParseSkipArgument(const std::string& value, snowcrash::BlueprintParserOptions& options)
+{
+    std::vector<std::string> contents = snowcrash::Split(value, ',');
+
+    for (std::vector<std::string>::iterator it = contents.begin(); it != contents.end(); ++it) {
+
+        snowcrash::TrimString(*it);
+
+        if (*it == "bodies")
+            options |= snowcrash::SkipBodiesOption;
+        else if (*it == "schemas")
+            options |= snowcrash::SkipSchemasOption;
+        else if (*it == "descriptions")
+            options |= snowcrash::SkipDescriptionsOption;
+        else if (*it == "parameters")
+            options |= snowcrash::SkipParametersOption;
+        else {
+            std::cerr << "unknown content to skip '" << *it << "', expected bodies, schemas, descriptions or parameters" << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
 /// \brief Print Markdown source annotation.
 /// \param prefix A string prefix for the annotation
 /// \param annotation An annotation to print
@@ -96,6 +173,11 @@ int main(int argc, const char *argv[])
     argumentParser.add("help", 'h', "display this help message");
     argumentParser.add(VersionArgument, 'v', "print Snow Crash version");
     argumentParser.add(ValidateArgument, 'l', "validate input only, do not print AST");
+    argumentParser.add(StatsArgument, '\0', "print parser instrumentation statistics");
+    argumentParser.add<std::string>(TraceArgument, '\0', "save parser trace spans into file (Chrome trace-event JSON)", false);
+    argumentParser.add<std::string>(SkipArgument, '\0', "drop the listed content from the AST (comma-separated: bodies, schemas, descriptions, parameters)", false);
+    argumentParser.add<size_t>(JobsArgument, 'j', "number of threads serializing the AST", false, 1);
+    argumentParser.add<std::string>(SourcemapEncodingArgument, '\0', "sourcemap encoding, [location, length] ranges or base64 VLQ strings", false, "ranges", cmdline::oneof<std::string>("ranges", "vlq"));
 
     argumentParser.parse_check(argc, argv);
 
@@ -140,58 +222,84 @@ int main(int argc, const char *argv[])
         options |= snowcrash::ExportSourcemapOption;
     }
 
+    if (argumentParser.exist(SkipArgument) &&
+        !ParseSkipArgument(argumentParser.get<std::string>(SkipArgument), options)) {
+        exit(EXIT_FAILURE);
+    }
+
     // Parse
-    snowcrash::parse(inputStream.str(), options, blueprint);
+    snowcrash::ParseStatistics statistics;
+    bool instrument = argumentParser.exist(StatsArgument) || argumentParser.exist(TraceArgument);
+
+    snowcrash::parse(inputStream.str(), options, blueprint, instrument ? &statistics : NULL);
 
     // Output
     if (!argumentParser.exist(ValidateArgument)) {
 
-        std::stringstream outputStream;
-        std::stringstream sourcemapOutputStream;
-
-        if (argumentParser.get<std::string>(FormatArgument) == "json") {
-            SerializeJSON(blueprint.node, outputStream);
-            SerializeSourceMapJSON(blueprint.sourceMap, sourcemapOutputStream);
-        }
-        else if (argumentParser.get<std::string>(FormatArgument) == "yaml") {
-            SerializeYAML(blueprint.node, outputStream);
-            SerializeSourceMapYAML(blueprint.sourceMap, sourcemapOutputStream);
-        }
-
+        SerializationFormat format = (argumentParser.get<std::string>(FormatArgument) == "json") ? JSONSerializationFormat : YAMLSerializationFormat;
         std::string outputFileName = argumentParser.get<std::string>(OutputArgument);
         std::string sourcemapOutputFileName = argumentParser.get<std::string>(SourcemapArgument);
 
-        if (!outputFileName.empty()) {
-            // Serialize to file
-            std::ofstream outputFileStream;
-            outputFileStream.open(outputFileName.c_str());
+        // Open the destinations before serializing anything
+        std::ofstream outputFileStream;
+        std::ofstream sourcemapOutputFileStream;
 
-            if (!outputFileStream.is_open()) {
-                std::cerr << "fatal: unable to write to file '" <<  outputFileName << "'\n";
-                exit(EXIT_FAILURE);
-            }
+        if (!outputFileName.empty())
+            OpenOutputFile(outputFileName, outputFileStream);
 
-            outputFileStream << outputStream.rdbuf();
-            outputFileStream.close();
-        }
-        else {
-            // Serialize to stdout
-            std::cout << outputStream.rdbuf();
-        }
+        if (!sourcemapOutputFileName.empty())
+            OpenOutputFile(sourcemapOutputFileName, sourcemapOutputFileStream);
+
+        // Serialize only the requested artifacts straight into their destinations,
+        // the AST and its source map concurrently
+        OutputArtifact artifacts[2];
+        size_t artifactsCount = 0;
+
+        OutputArtifact& ast = artifacts[artifactsCount++];
+        ast.blueprint = &blueprint;
+        ast.format = format;
+        ast.sourceMap = false;
+        ast.jobs = argumentParser.get<size_t>(JobsArgument);
+        ast.os = outputFileName.empty() ? &std::cout : &outputFileStream;
 
         if (!sourcemapOutputFileName.empty()) {
-            // Serialize to file
-            std::ofstream sourcemapOutputFileStream;
-            sourcemapOutputFileStream.open(sourcemapOutputFileName.c_str());
+            OutputArtifact& sourceMap = artifacts[artifactsCount++];
+            sourceMap = ast;
+            sourceMap.sourceMap = true;
+            sourceMap.os = &sourcemapOutputFileStream;
 
-            if (!sourcemapOutputFileStream.is_open()) {
-                std::cerr << "fatal: unable to write to file '" << sourcemapOutputFileName << "'\n";
-                exit(EXIT_FAILURE);
-            }
+            if (argumentParser.get<std::string>(SourcemapEncodingArgument) == "vlq")
+                snowcrash::SetSourceMapEncoding(sourcemapOutputFileStream, snowcrash::VLQSourceMapEncoding);
+        }
+
+        snowcrash::ParallelFor(artifactsCount, artifactsCount, OutputArtifact::serialize, artifacts);
+
+        if (outputFileStream.is_open())
+            outputFileStream.close();
 
-            sourcemapOutputFileStream << sourcemapOutputStream.rdbuf();
+        if (sourcemapOutputFileStream.is_open())
             sourcemapOutputFileStream.close();
+    }
+
+    // Instrumentation
+    if (argumentParser.exist(TraceArgument)) {
+
+        std::string traceFileName = argumentParser.get<std::string>(TraceArgument);
+        std::ofstream traceFileStream;
+        traceFileStream.open(traceFileName.c_str());
+
+        if (!traceFileStream.is_open()) {
+            std::cerr << "fatal: unable to write to file '" << traceFileName << "'\n";
+            exit(EXIT_FAILURE);
         }
+
+        snowcrash::SerializeTraceEventsJSON(statistics, traceFileStream);
+        traceFileStream.close();
+    }
+
+    if (argumentParser.exist(StatsArgument)) {
+        std::cerr << std::endl;
+        snowcrash::PrintStatistics(statistics, std::cerr);
     }
 
     // report
@@ -0,0 +1,51 @@
+//
+//  CancellationToken.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <windows.h>
+#include "CancellationToken.h"
+
+using namespace snowcrash;
+
+/** \returns Monotonic time in milliseconds, does not wrap around */
+static double Milliseconds()
+{
+    LARGE_INTEGER frequency, counter;
+    ::QueryPerformanceFrequency(&frequency);
+    ::QueryPerformanceCounter(&counter);
+
+    return (counter.QuadPart * 1000.0) / frequency.QuadPart;
+}
+
+void CancellationToken::cancel()
+{
+    ::InterlockedExchange(&m_cancelled, 1);
+}
+
+bool CancellationToken::isCancelled() const
+{
+    return ::InterlockedCompareExchange(const_cast<long*>(&m_cancelled), 0, 0) != 0;
+}
+
+void CancellationToken::setTimeout(unsigned int milliseconds)
+{
+    m_deadline = (milliseconds) ? Milliseconds() + milliseconds : 0;
+}
+
+bool CancellationToken::isExpired() const
+{
+    return m_deadline != 0 && Milliseconds() >= m_deadline;
+}
+
+void CancellationToken::check() const
+{
+    if (isCancelled())
+        throw CancellationException("parsing has been cancelled", CancelledError);
+
+    if (isExpired())
+        throw CancellationException("parsing deadline has been exceeded", DeadlineExceededError);
+}
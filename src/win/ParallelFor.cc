@@ -0,0 +1,82 @@
+//
+//  ParallelFor.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <windows.h>
+#include <vector>
+#include "ParallelFor.h"
+
+using namespace snowcrash;
+
+namespace {
+
+    // Work shared by the threads of one ParallelFor
+    struct ParallelWork {
+        size_t count;
+        size_t next;
+        ParallelTask task;
+        void* context;
+        CRITICAL_SECTION lock;
+    };
+
+    DWORD WINAPI ParallelWorker(LPVOID data)
+    {
+        ParallelWork* work = static_cast<ParallelWork*>(data);
+
+        for (;;) {
+            ::EnterCriticalSection(&work->lock);
+            size_t index = work->next++;
+            ::LeaveCriticalSection(&work->lock);
+
+            if (index >= work->count)
+                return 0;
+
+            work->task(index, work->context);
+        }
+    }
+}
+
+void snowcrash::ParallelFor(size_t count, size_t threads, ParallelTask task, void* context)
+{
+    if (threads > count)
+        threads = count;
+
+    if (threads <= 1) {
+        for (size_t i = 0; i < count; ++i)
+            task(i, context);
+
+        return;
+    }
+
+    ParallelWork work;
+    work.count = count;
+    work.next = 0;
+    work.task = task;
+    work.context = context;
+    ::InitializeCriticalSection(&work.lock);
+
+    // The calling thread is one of the workers
+    std::vector<HANDLE> workers;
+
+    for (size_t i = 1; i < threads; ++i) {
+        HANDLE worker = ::CreateThread(NULL, 0, ParallelWorker, &work, 0, NULL);
+
+        if (worker == NULL)
+            break;
+
+        workers.push_back(worker);
+    }
+
+    ParallelWorker(&work);
+
+    for (std::vector<HANDLE>::iterator it = workers.begin(); it != workers.end(); ++it) {
+        ::WaitForSingleObject(*it, INFINITE);
+        ::CloseHandle(*it);
+    }
+
+    ::DeleteCriticalSection(&work.lock);
+}
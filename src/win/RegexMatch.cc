@@ -8,7 +8,9 @@
 
 #include <regex>
 #include <cstring>
+#include <map>
 #include "RegexMatch.h"
+#include "ParseStatistics.h"
 
 using namespace std;
 
@@ -19,14 +21,95 @@ using namespace std::tr1;
 // A C++09 implementation
 //
 
+/** Expressions compiled once per cache, NULL if an expression does not compile */
+struct snowcrash::RegexCache::Expressions {
+
+    typedef std::map<string, regex*> Compiled;
+
+    Compiled compiled;
+};
+
+/** Regex cache used by the current thread */
+static SC_THREAD_LOCAL snowcrash::RegexCache* ActiveCache = NULL;
+
+snowcrash::RegexCache::RegexCache()
+: m_expressions(new Expressions)
+{
+}
+
+snowcrash::RegexCache::~RegexCache()
+{
+    clear();
+    delete m_expressions;
+}
+
+void snowcrash::RegexCache::clear()
+{
+    for (Expressions::Compiled::iterator it = m_expressions->compiled.begin(); it != m_expressions->compiled.end(); ++it) {
+        delete it->second;
+    }
+
+    m_expressions->compiled.clear();
+}
+
+snowcrash::RegexCache* snowcrash::RegexCache::active()
+{
+    return ActiveCache;
+}
+
+void snowcrash::RegexCache::setActive(RegexCache* cache)
+{
+    ActiveCache = cache;
+}
+
+/**
+ *  \brief Compile an expression, or take it from the active cache
+ *  \param local   Storage to compile into without an active cache
+ *  \return Compiled expression, throws regex_error if it does not compile
+ */
+static const regex* CompileRegex(const string& expression, regex& local)
+{
+    snowcrash::RegexCache* cache = snowcrash::RegexCache::active();
+
+    if (!cache) {
+        local.assign(expression, regex_constants::extended);
+        return &local;
+    }
+
+    snowcrash::RegexCache::Expressions::Compiled& compiled = cache->expressions().compiled;
+    snowcrash::RegexCache::Expressions::Compiled::iterator it = compiled.find(expression);
+
+    if (it != compiled.end()) {
+        if (!it->second)
+            throw regex_error(regex_constants::error_badpattern);
+
+        return it->second;
+    }
+
+    regex* pattern = NULL;
+
+    try {
+        pattern = new regex(expression, regex_constants::extended);
+    }
+    catch (...) {
+        compiled[expression] = NULL;
+        throw;
+    }
+
+    compiled[expression] = pattern;
+    return pattern;
+}
+
 bool snowcrash::RegexMatch(const string& target, const string& expression)
 {
     if (target.empty() || expression.empty())
         return false;
 
+    SC_INSTRUMENT_REGEX(expression);
+
     try {
-        regex pattern(expression, regex_constants::extended);
-        return regex_search(target, pattern);
+        regex local;
+        return regex_search(target, *CompileRegex(expression, local));
     }
     catch (const regex_error&) {
     }
@@ -51,13 +134,15 @@ bool snowcrash::RegexCapture(const string& target, const string& expression, Cap
     if (target.empty() || expression.empty())
         return false;
 
+    SC_INSTRUMENT_REGEX(expression);
+
     captureGroups.clear();
 
     try {
 
-        regex pattern(expression, regex_constants::extended);
+        regex local;
         match_results<string::const_iterator> result;
-        if (!regex_search(target, result, pattern))
+        if (!regex_search(target, result, *CompileRegex(expression, local)))
             return false;
 
         for (match_results<string::const_iterator>::const_iterator it = result.begin();
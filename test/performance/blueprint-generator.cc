@@ -0,0 +1,143 @@
+//
+//  blueprint-generator.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <algorithm>
+#include <sstream>
+#include "blueprint-generator.h"
+
+using namespace snowcrashperf;
+
+/** HTTP methods used for generated actions, none of them forbids a body */
+static const char* const GeneratedMethods[] = {
+    "GET", "POST", "PUT", "DELETE", "PATCH", "OPTIONS", "PROPPATCH",
+    "LOCK", "UNLOCK", "COPY", "MOVE", "MKCOL", "LINK", "UNLINK"
+};
+
+static const size_t GeneratedMethodsCount = sizeof(GeneratedMethods) / sizeof(GeneratedMethods[0]);
+
+/** Indentation of an asset nested in a payload section */
+static const std::string AssetIndentation = "        ";
+
+size_t snowcrashperf::MaxActionsPerResource()
+{
+    return GeneratedMethodsCount;
+}
+
+/** Append an indented pseudo-JSON body of given size (excluding indentation) */
+static void AppendBody(size_t size, std::stringstream& ss)
+{
+    static const std::string Line = "\"property\": \"lorem ipsum dolor sit amet consectetur\",";
+
+    ss << AssetIndentation << "{\n";
+
+    size_t written = 2;
+    while (written < size) {
+
+        size_t length = std::min(Line.length(), size - written);
+        ss << AssetIndentation << "    " << Line.substr(0, length) << "\n";
+        written += length + 1;
+    }
+
+    ss << AssetIndentation << "}\n\n";
+}
+
+/** \returns Name of the resource used as its model symbol */
+static std::string ResourceName(size_t group, size_t resource)
+{
+    std::stringstream ss;
+    ss << "Resource " << group << "-" << resource;
+    return ss.str();
+}
+
+static void GenerateAction(const GeneratorSettings& settings,
+                           size_t group,
+                           size_t resource,
+                           size_t action,
+                           std::stringstream& ss)
+{
+    ss << "### Action " << group << "-" << resource << "-" << action;
+    ss << " [" << GeneratedMethods[action] << "]\n";
+    ss << "Action " << action << " of resource " << group << "-" << resource << ".\n\n";
+
+    for (size_t example = 0; example < settings.examples; ++example) {
+
+        ss << "+ Request Example " << example << " (application/json)\n\n";
+        AppendBody(settings.bodySize, ss);
+
+        ss << "+ Response 200";
+
+        if (example < settings.modelReferences) {
+            ss << "\n\n    [" << ResourceName(group, resource) << "][]\n\n";
+        }
+        else {
+            ss << " (application/json)\n\n";
+            AppendBody(settings.bodySize, ss);
+        }
+    }
+}
+
+static void GenerateResource(const GeneratorSettings& settings,
+                             size_t group,
+                             size_t resource,
+                             std::stringstream& ss)
+{
+    ss << "## " << ResourceName(group, resource) << " [/group-" << group << "/resource-" << resource;
+
+    for (size_t parameter = 0; parameter < settings.parameters; ++parameter) {
+        ss << "/{param" << parameter << "}";
+    }
+
+    ss << "]\n";
+    ss << "Resource " << resource << " of group " << group << ".\n\n";
+
+    if (settings.parameters) {
+
+        ss << "+ Parameters\n";
+
+        for (size_t parameter = 0; parameter < settings.parameters; ++parameter) {
+            ss << "    + param" << parameter << " (required, string, `value-" << parameter << "`) ";
+            ss << "... Parameter " << parameter << ".\n";
+        }
+
+        ss << "\n";
+    }
+
+    if (settings.modelReferences) {
+
+        ss << "+ Model (application/json)\n\n";
+        AppendBody(settings.bodySize, ss);
+    }
+
+    size_t actions = std::min(settings.actions, GeneratedMethodsCount);
+
+    for (size_t action = 0; action < actions; ++action) {
+        GenerateAction(settings, group, resource, action, ss);
+    }
+}
+
+void snowcrashperf::GenerateBlueprint(const GeneratorSettings& settings, std::string& output)
+{
+    std::stringstream ss;
+
+    ss << "FORMAT: 1A\n";
+    ss << "HOST: http://api.example.com\n\n";
+    ss << "# Generated API\n";
+    ss << "Synthetic blueprint with " << settings.groups << " group(s) of " << settings.resources << " resource(s).\n\n";
+
+    for (size_t group = 0; group < settings.groups; ++group) {
+
+        ss << "# Group Group " << group << "\n";
+        ss << "Resource group " << group << ".\n\n";
+
+        for (size_t resource = 0; resource < settings.resources; ++resource) {
+            GenerateResource(settings, group, resource, ss);
+        }
+    }
+
+    output = ss.str();
+}
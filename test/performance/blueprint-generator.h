@@ -0,0 +1,59 @@
+//
+//  blueprint-generator.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_BLUEPRINTGENERATOR_H
+#define SNOWCRASH_BLUEPRINTGENERATOR_H
+
+#include <string>
+
+namespace snowcrashperf {
+
+    /**
+     *  \brief Synthetic blueprint settings
+     *
+     *  All counts except `groups` are per parent section.
+     */
+    struct GeneratorSettings {
+
+        GeneratorSettings()
+        : groups(10), resources(10), actions(4), examples(2), parameters(3), modelReferences(1), bodySize(256) {}
+
+        /** Number of resource groups */
+        size_t groups;
+
+        /** Number of resources per group */
+        size_t resources;
+
+        /** Number of actions per resource, at most one per HTTP method */
+        size_t actions;
+
+        /** Number of transaction examples per action */
+        size_t examples;
+
+        /** Number of URI parameters per resource */
+        size_t parameters;
+
+        /** Number of responses per action referring the resource model */
+        size_t modelReferences;
+
+        /** Size of every asset body in bytes */
+        size_t bodySize;
+    };
+
+    /** \returns Maximum number of actions per resource */
+    size_t MaxActionsPerResource();
+
+    /**
+     *  \brief Generate a synthetic API blueprint
+     *  \param settings Shape of the blueprint to generate
+     *  \param output   Buffer to store the generated blueprint into
+     */
+    void GenerateBlueprint(const GeneratorSettings& settings, std::string& output);
+}
+
+#endif
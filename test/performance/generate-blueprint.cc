@@ -0,0 +1,77 @@
+//
+//  generate-blueprint.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <iostream>
+#include <sstream>
+#include <fstream>
+#include <cstdlib>
+#include "cmdline.h"
+#include "blueprint-generator.h"
+
+using snowcrashperf::GeneratorSettings;
+
+static const std::string OutputArgument = "output";
+
+int main(int argc, const char *argv[])
+{
+    GeneratorSettings settings;
+
+    // Setup commandline Argument Parser
+    cmdline::parser argumentParser;
+    argumentParser.set_program_name("generate-blueprint");
+    std::stringstream ss;
+    ss << "\n\nSynthetic API Blueprint Generator\n";
+    ss << "Counts except groups are per parent section.\n";
+
+    argumentParser.footer(ss.str());
+    argumentParser.add<std::string>(OutputArgument, 'o', "save generated blueprint into file", false);
+    argumentParser.add<size_t>("groups", 'g', "number of resource groups", false, settings.groups);
+    argumentParser.add<size_t>("resources", 'r', "resources per group", false, settings.resources);
+    argumentParser.add<size_t>("actions", 'a', "actions per resource", false, settings.actions);
+    argumentParser.add<size_t>("examples", 'e', "transaction examples per action", false, settings.examples);
+    argumentParser.add<size_t>("parameters", 'p', "URI parameters per resource", false, settings.parameters);
+    argumentParser.add<size_t>("references", 'm', "responses referring the resource model per action", false, settings.modelReferences);
+    argumentParser.add<size_t>("body-size", 'b', "size of every asset body in bytes", false, settings.bodySize);
+    argumentParser.add("help", 'h', "display this help message");
+
+    argumentParser.parse_check(argc, argv);
+
+    settings.groups = argumentParser.get<size_t>("groups");
+    settings.resources = argumentParser.get<size_t>("resources");
+    settings.actions = argumentParser.get<size_t>("actions");
+    settings.examples = argumentParser.get<size_t>("examples");
+    settings.parameters = argumentParser.get<size_t>("parameters");
+    settings.modelReferences = argumentParser.get<size_t>("references");
+    settings.bodySize = argumentParser.get<size_t>("body-size");
+
+    if (settings.actions > snowcrashperf::MaxActionsPerResource()) {
+        std::cerr << "at most " << snowcrashperf::MaxActionsPerResource() << " actions per resource are supported\n";
+        exit(EXIT_FAILURE);
+    }
+
+    std::string blueprint;
+    snowcrashperf::GenerateBlueprint(settings, blueprint);
+
+    std::string outputFileName = argumentParser.get<std::string>(OutputArgument);
+
+    if (outputFileName.empty()) {
+        std::cout << blueprint;
+        return EXIT_SUCCESS;
+    }
+
+    std::ofstream outputFileStream(outputFileName.c_str());
+    if (!outputFileStream.is_open()) {
+        std::cerr << "fatal: unable to write to file '" << outputFileName << "'\n";
+        exit(EXIT_FAILURE);
+    }
+
+    outputFileStream << blueprint;
+    outputFileStream.close();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,112 @@
+//
+//  perf-capi.c
+//  snowcrash
+//  C API harness comparing `sc_c_parse` with `sc_c_parse_v2`
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "csnowcrash.h"
+
+#define DEFAULT_ITERATIONS 100
+
+/* Read whole file, returns NULL on failure */
+static char* ReadSource(const char* path, size_t* length)
+{
+    FILE* file = fopen(path, "rb");
+    char* source;
+    long size;
+
+    if (!file)
+        return NULL;
+
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    source = (char*)malloc(size + 1);
+    *length = fread(source, 1, size, file);
+    source[*length] = '\0';
+
+    fclose(file);
+    return source;
+}
+
+/* Parse with the original entry point, returns ms per parse */
+static double MeasureParse(const char* source, sc_blueprint_parser_options option, int iterations)
+{
+    clock_t start = clock();
+    int i;
+
+    for (i = 0; i < iterations; ++i) {
+        sc_report_t* report;
+        sc_blueprint_t* blueprint;
+        sc_sm_blueprint_t* sm_blueprint;
+
+        sc_c_parse(source, option, &report, &blueprint, &sm_blueprint);
+
+        sc_sm_blueprint_free(sm_blueprint);
+        sc_blueprint_free(blueprint);
+        sc_report_free(report);
+    }
+
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC / iterations;
+}
+
+/* Parse with the single allocation entry point, returns ms per parse */
+static double MeasureParseV2(const char* source, size_t length, int sourcemap, int iterations)
+{
+    clock_t start = clock();
+    int i;
+
+    for (i = 0; i < iterations; ++i) {
+        sc_parse_result_t* result;
+        const sc_blueprint_t* blueprint;
+        const sc_sm_blueprint_t* sm_blueprint;
+
+        sc_c_parse_v2(source, length, 0, &result, NULL, &blueprint, sourcemap ? &sm_blueprint : NULL);
+        sc_parse_result_free(result);
+    }
+
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC / iterations;
+}
+
+int main(int argc, const char* argv[])
+{
+    size_t length;
+    char* source;
+    int iterations = DEFAULT_ITERATIONS;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: perf-capi <input file> [iterations]\n");
+        return EXIT_FAILURE;
+    }
+
+    if (argc > 2)
+        iterations = atoi(argv[2]);
+
+    if (iterations <= 0) {
+        fprintf(stderr, "invalid number of iterations '%s'\n", argv[2]);
+        return EXIT_FAILURE;
+    }
+
+    source = ReadSource(argv[1], &length);
+
+    if (!source) {
+        fprintf(stderr, "fatal: unable to open input file '%s'\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    printf("%d iterations, %lu bytes\n", iterations, (unsigned long)length);
+    printf("sc_c_parse                    %8.3f ms\n", MeasureParse(source, 0, iterations));
+    printf("sc_c_parse (source map)       %8.3f ms\n", MeasureParse(source, SC_EXPORT_SORUCEMAP_OPTION, iterations));
+    printf("sc_c_parse_v2                 %8.3f ms\n", MeasureParseV2(source, length, 0, iterations));
+    printf("sc_c_parse_v2 (source map)    %8.3f ms\n", MeasureParseV2(source, length, 1, iterations));
+
+    free(source);
+    return EXIT_SUCCESS;
+}
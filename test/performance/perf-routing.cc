@@ -0,0 +1,189 @@
+//
+//  perf-routing.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "RouteIndex.h"
+#include "perf-snowcrash.h"
+
+using namespace snowcrashperf;
+using namespace snowcrash;
+
+/** Request resolved in the benchmark */
+struct RoutingRequest {
+    HTTPMethod method;
+    std::string path;
+};
+
+/** \returns Request path of a URI template with every expression expanded to `value` */
+static std::string ExpandURITemplate(const URITemplate& uriTemplate)
+{
+    std::string path;
+    size_t start = 0;
+
+    while (start < uriTemplate.length()) {
+
+        size_t open = uriTemplate.find('{', start);
+        path += uriTemplate.substr(start, open - start);
+
+        if (open == std::string::npos)
+            break;
+
+        size_t close = uriTemplate.find('}', open);
+
+        if (close == std::string::npos)
+            break;
+
+        path += "value";
+        start = close + 1;
+    }
+
+    return path;
+}
+
+/** \returns True if every request resolves to an action using the matcher */
+template <typename Matcher>
+static bool ResolveAll(const Matcher& matcher, const std::vector<RoutingRequest>& requests, size_t lookups, double& time)
+{
+    RouteMatch match;
+    double start = Now();
+
+    for (size_t i = 0; i < lookups; ++i) {
+
+        const RoutingRequest& request = requests[i % requests.size()];
+
+        if (!matcher.match(request.method, request.path, match))
+            return false;
+    }
+
+    time = Now() - start;
+    return true;
+}
+
+/** Baseline matcher trying one resource after another */
+struct LinearMatcher {
+
+    std::vector<Blueprint> blueprints;
+    std::vector<RouteIndex*> indices;
+
+    LinearMatcher(const Blueprint& blueprint) {
+
+        for (ResourceGroups::const_iterator group = blueprint.resourceGroups.begin();
+             group != blueprint.resourceGroups.end();
+             ++group) {
+
+            for (Resources::const_iterator resource = group->resources.begin();
+                 resource != group->resources.end();
+                 ++resource) {
+
+                ResourceGroup single;
+                single.resources.push_back(*resource);
+
+                blueprints.push_back(Blueprint());
+                blueprints.back().resourceGroups.push_back(single);
+            }
+        }
+
+        for (std::vector<Blueprint>::const_iterator it = blueprints.begin(); it != blueprints.end(); ++it) {
+            indices.push_back(new RouteIndex(*it));
+        }
+    }
+
+    ~LinearMatcher() {
+
+        for (std::vector<RouteIndex*>::iterator it = indices.begin(); it != indices.end(); ++it)
+            delete *it;
+    }
+
+    bool match(const HTTPMethod& method, const std::string& path, RouteMatch& match) const {
+
+        for (std::vector<RouteIndex*>::const_iterator it = indices.begin(); it != indices.end(); ++it) {
+            if ((*it)->match(method, path, match))
+                return true;
+        }
+
+        return false;
+    }
+};
+
+int snowcrashperf::RunRoutingBenchmark(const RoutingSettings& settings)
+{
+    std::string source;
+    GenerateBlueprint(settings.base, source);
+
+    ParseResult<Blueprint> blueprint;
+    parse(source, 0, blueprint);
+
+    if (blueprint.report.error.code != Error::OK) {
+        std::cerr << "fatal: generated blueprint failed to parse (" << blueprint.report.error.code << ")\n";
+        return EXIT_FAILURE;
+    }
+
+    std::vector<RoutingRequest> requests;
+
+    for (ResourceGroups::const_iterator group = blueprint.node.resourceGroups.begin();
+         group != blueprint.node.resourceGroups.end();
+         ++group) {
+
+        for (Resources::const_iterator resource = group->resources.begin();
+             resource != group->resources.end();
+             ++resource) {
+
+            for (Actions::const_iterator action = resource->actions.begin();
+                 action != resource->actions.end();
+                 ++action) {
+
+                RoutingRequest request;
+                request.method = action->method;
+                request.path = ExpandURITemplate(resource->uriTemplate);
+                requests.push_back(request);
+            }
+        }
+    }
+
+    if (requests.empty() || settings.lookups == 0) {
+        std::cerr << "fatal: nothing to resolve\n";
+        return EXIT_FAILURE;
+    }
+
+    double start = Now();
+    RouteIndex index(blueprint.node);
+    double buildTime = Now() - start;
+
+    LinearMatcher linear(blueprint.node);
+    double indexTime = 0, linearTime = 0;
+
+    if (!ResolveAll(index, requests, settings.lookups, indexTime) ||
+        !ResolveAll(linear, requests, settings.lookups, linearTime)) {
+
+        std::cerr << "fatal: a generated request did not resolve\n";
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "routes: " << index.size() << " (" << index.skipped() << " skipped)\n";
+    std::cout << "build: " << buildTime * 1000.0 << "ms\n";
+    std::cout << std::setw(10) << "matcher"
+              << std::setw(14) << "lookups"
+              << std::setw(14) << "total (s)"
+              << std::setw(14) << "us/lookup" << "\n";
+    std::cout << std::setw(10) << "index"
+              << std::setw(14) << settings.lookups
+              << std::setw(14) << indexTime
+              << std::setw(14) << (indexTime * 1000000.0) / settings.lookups << "\n";
+    std::cout << std::setw(10) << "linear"
+              << std::setw(14) << settings.lookups
+              << std::setw(14) << linearTime
+              << std::setw(14) << (linearTime * 1000000.0) / settings.lookups << "\n";
+
+    if (indexTime > 0)
+        std::cout << "\nspeedup: " << std::setprecision(3) << linearTime / indexTime << "x\n";
+
+    return EXIT_SUCCESS;
+}
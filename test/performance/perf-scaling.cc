@@ -0,0 +1,111 @@
+//
+//  perf-scaling.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "perf-snowcrash.h"
+
+using namespace snowcrashperf;
+
+/** Measured blueprint size */
+struct ScalingSample {
+    double size;    /// < Size of the source in bytes
+    double time;    /// < Mean parsing time in seconds
+};
+
+/** \returns Slope of the least-squares line fitted through log-log samples */
+static double GrowthExponent(const std::vector<ScalingSample>& samples)
+{
+    double n = samples.size();
+    double sx = 0, sy = 0, sxx = 0, sxy = 0;
+
+    for (std::vector<ScalingSample>::const_iterator it = samples.begin(); it != samples.end(); ++it) {
+
+        double x = std::log(it->size);
+        double y = std::log(it->time);
+
+        sx += x;
+        sy += y;
+        sxx += x * x;
+        sxy += x * y;
+    }
+
+    double denominator = n * sxx - sx * sx;
+
+    if (denominator == 0)
+        return 0;
+
+    return (n * sxy - sx * sy) / denominator;
+}
+
+int snowcrashperf::RunScalingBenchmark(const ScalingSettings& settings)
+{
+    std::vector<ScalingSample> samples;
+
+    std::cout << std::setw(8) << "groups"
+              << std::setw(14) << "size (B)"
+              << std::setw(14) << "mean (s)"
+              << std::setw(14) << "stddev (s)"
+              << std::setw(14) << "us/KB"
+              << std::setw(10) << "local k" << "\n";
+
+    for (size_t step = 0; step < settings.steps; ++step) {
+
+        GeneratorSettings generatorSettings = settings.base;
+        generatorSettings.groups = settings.base.groups << step;
+
+        std::string source;
+        GenerateBlueprint(generatorSettings, source);
+
+        Timing timing;
+        int result = MeasureParse(source, settings.options, settings.runCount, timing);
+
+        if (result != snowcrash::Error::OK) {
+            std::cerr << "fatal: generated blueprint failed to parse (" << result << ")\n";
+            return EXIT_FAILURE;
+        }
+
+        ScalingSample sample;
+        sample.size = source.length();
+        sample.time = timing.mean;
+
+        std::cout << std::setw(8) << generatorSettings.groups
+                  << std::setw(14) << source.length()
+                  << std::setw(14) << timing.mean
+                  << std::setw(14) << timing.stddev
+                  << std::setw(14) << (timing.mean * 1000000.0) / (sample.size / 1024.0);
+
+        if (!samples.empty() && sample.time > 0 && samples.back().time > 0) {
+            double k = std::log(sample.time / samples.back().time) / std::log(sample.size / samples.back().size);
+            std::cout << std::setw(10) << std::setprecision(3) << k << std::setprecision(6);
+        }
+
+        std::cout << "\n";
+        samples.push_back(sample);
+    }
+
+    if (samples.size() < 2) {
+        std::cerr << "at least two blueprint sizes are needed to fit the growth curve\n";
+        return EXIT_FAILURE;
+    }
+
+    double exponent = GrowthExponent(samples);
+
+    std::cout << "\ngrowth: time ~ size^" << std::setprecision(3) << exponent;
+    std::cout << " (acceptable up to " << settings.maxExponent << ")\n";
+
+    if (exponent > settings.maxExponent) {
+        std::cerr << "fatal: parsing time grows superlinearly with blueprint size\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
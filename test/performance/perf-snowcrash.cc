@@ -9,8 +9,9 @@
 #include <sstream>
 #include <fstream>
 #include <cmath>
+#include <algorithm>
 #include "cmdline.h"
-#include "snowcrash.h"
+#include "perf-snowcrash.h"
 
 #if defined (_MSC_VER)
 #include <windows.h>
@@ -23,6 +24,19 @@ using snowcrash::Error;
 
 static const int TestRunCount = 1000;
 
+static const std::string RunsArgument = "runs";
+static const std::string SourcemapArgument = "sourcemap";
+static const std::string ScalingArgument = "scaling";
+static const std::string StepsArgument = "steps";
+static const std::string MaxExponentArgument = "max-exponent";
+static const std::string RoutingArgument = "routing";
+static const std::string LookupsArgument = "lookups";
+static const std::string WarmArgument = "warm";
+static const std::string StringsArgument = "strings";
+static const std::string LinesArgument = "lines";
+static const std::string IterationsArgument = "iterations";
+static const std::string ThreadsArgument = "threads";
+
 #if defined (_MSC_VER)
 const __int64 DELTA_EPOCH_IN_MICROSECS = 11644473600000000;
 
@@ -67,49 +81,52 @@ int gettimeofday(struct timeval* tv, struct timezone* tz)
 #endif
 
 
-/**
- *  \brief  Parse input @TestRunCount -times
- *  \param  input   A blueprint source data.
- *  \param  total   Total time spent parsing (s).
- *  \param  mean    Mean time spent parsing (s).
- *  \param  stddev  Standard deviation.
- *  \return Result code of snowcrash::parse operation.
- */
-static int testfunc(const std::string& input, double& total, double& mean, double& stddev)
+double snowcrashperf::Now()
+{
+    struct timeval time;
+
+    if (::gettimeofday(&time, NULL)) {
+        std::cerr << "fatal: gettimeofday failed";
+        exit(EXIT_FAILURE);
+    }
+
+    return time.tv_sec + time.tv_usec / 1000000.0;
+}
+
+int snowcrashperf::MeasureParse(const std::string& input,
+                                snowcrash::BlueprintParserOptions options,
+                                int runCount,
+                                Timing& timing,
+                                snowcrash::Parser* parser)
 {
-	struct timeval stime, etime;
 	double t = 0, sum = 0, sum2 = 0;
 	int resultCode = snowcrash::Error::OK;
 
-	for (int i = 0; i < TestRunCount; ++i) {
-        snowcrash::BlueprintParserOptions options = 0;
+    // A reused parser also reuses its result, as a long-running service would
+    snowcrash::ParseResult<snowcrash::Blueprint> reused;
+
+	for (int i = 0; i < runCount; ++i) {
         snowcrash::ParseResult<snowcrash::Blueprint> blueprint;
 
 		// Do the test.
-		if (::gettimeofday(&stime, NULL)) {
-            std::cerr << "fatal: gettimeofday failed";
-			exit(EXIT_FAILURE);
-		}
-        
-        snowcrash::parse(input, options, blueprint);
-        
-		if (::gettimeofday(&etime, NULL)) {
-            std::cerr << "fatal: gettimeofday failed";
-			exit(EXIT_FAILURE);
-		}
-
-        resultCode = blueprint.report.error.code;
-        
-		// Compute the time taken and add it to the sums.
-		t = (etime.tv_sec - stime.tv_sec) + (etime.tv_usec - stime.tv_usec) / 1000000.0;
+        double start = Now();
+        if (parser)
+            parser->parse(input, options, reused);
+        else
+            snowcrash::parse(input, options, blueprint);
+        t = Now() - start;
+
+        resultCode = parser ? reused.report.error.code : blueprint.report.error.code;
+
+		// Add the time taken to the sums.
 		sum += t;
 		sum2 += t * t;
 	}
-    
+
 	// Compute statistics and return result
-    total = sum;
-	mean = sum / TestRunCount;
-	stddev = std::sqrt((sum2 / TestRunCount) - (mean * mean));
+    timing.total = sum;
+	timing.mean = sum / runCount;
+	timing.stddev = std::sqrt(std::max((sum2 / runCount) - (timing.mean * timing.mean), 0.0));
 	return resultCode;
 }
 
@@ -119,16 +136,118 @@ int main(int argc, const char *argv[])
     //::sleep(20);
     
     // Setup commandline Argument Parser
+    snowcrashperf::ScalingSettings scaling;
+    snowcrashperf::RoutingSettings routing;
+    snowcrashperf::StringsSettings strings;
+    snowcrashperf::ThreadsSettings threads;
+
     cmdline::parser argumentParser;
     argumentParser.set_program_name("perf-snowcrash");
     std::stringstream ss;
     ss << "<input file>\n\n";
     ss << "API Blueprint Parser Performance Test Tool\n";
+    ss << "\nUse --scaling to measure parsing of generated blueprints of growing size instead of an input file.\n";
+    ss << "Use --routing to measure resolving requests against a generated blueprint.\n";
+    ss << "Use --strings to compare the copying string helpers with their view-based equivalents.\n";
+    ss << "Use --threads N to measure parsing of the input files on 1 to N threads at once.\n";
 
     argumentParser.footer(ss.str());
     argumentParser.add("help", 'h', "display this help message");
+    argumentParser.add<int>(RunsArgument, 'n', "number of parser runs", false, TestRunCount);
+    argumentParser.add(SourcemapArgument, 's', "export sourcemaps while parsing");
+    argumentParser.add(WarmArgument, 'w', "compare parsing with a reused parser to parsing with a new one");
+    argumentParser.add(ScalingArgument, 'S', "run the scaling benchmark on generated blueprints");
+    argumentParser.add<size_t>(StepsArgument, '\0', "number of generated blueprint sizes", false, scaling.steps);
+    argumentParser.add<double>(MaxExponentArgument, '\0', "maximum acceptable growth exponent", false, scaling.maxExponent);
+    argumentParser.add(RoutingArgument, 'R', "run the routing benchmark on a generated blueprint");
+    argumentParser.add<size_t>(LookupsArgument, '\0', "number of requests resolved by the routing benchmark", false, routing.lookups);
+    argumentParser.add(StringsArgument, '\0', "run the string helpers benchmark");
+    argumentParser.add<size_t>(LinesArgument, '\0', "number of lines measured by the string helpers benchmark", false, strings.lines);
+    argumentParser.add<size_t>(IterationsArgument, '\0', "number of runs of every string helper", false, strings.iterations);
+    argumentParser.add<size_t>(ThreadsArgument, 'T', "run the concurrent parsing benchmark on up to N threads", false, threads.threads);
+    argumentParser.add<size_t>("groups", '\0', "resource groups in the smallest generated blueprint", false, scaling.base.groups);
+    argumentParser.add<size_t>("resources", '\0', "resources per group", false, scaling.base.resources);
+    argumentParser.add<size_t>("actions", '\0', "actions per resource", false, scaling.base.actions);
+    argumentParser.add<size_t>("examples", '\0', "transaction examples per action", false, scaling.base.examples);
+    argumentParser.add<size_t>("parameters", '\0', "URI parameters per resource", false, scaling.base.parameters);
+    argumentParser.add<size_t>("references", '\0', "model references per action", false, scaling.base.modelReferences);
+    argumentParser.add<size_t>("body-size", '\0', "size of every asset body in bytes", false, scaling.base.bodySize);
 
     argumentParser.parse_check(argc, argv);
+
+    snowcrash::BlueprintParserOptions options = 0;
+    if (argumentParser.exist(SourcemapArgument))
+        options |= snowcrash::ExportSourcemapOption;
+
+    if (argumentParser.exist(RoutingArgument)) {
+
+        routing.lookups = argumentParser.get<size_t>(LookupsArgument);
+        routing.base.groups = argumentParser.get<size_t>("groups");
+        routing.base.resources = argumentParser.get<size_t>("resources");
+        routing.base.actions = argumentParser.get<size_t>("actions");
+        routing.base.examples = argumentParser.get<size_t>("examples");
+        routing.base.parameters = argumentParser.get<size_t>("parameters");
+        routing.base.modelReferences = argumentParser.get<size_t>("references");
+        routing.base.bodySize = argumentParser.get<size_t>("body-size");
+
+        std::cout << "running snowcrash routing test...\n";
+        return snowcrashperf::RunRoutingBenchmark(routing);
+    }
+
+    if (argumentParser.exist(StringsArgument)) {
+
+        strings.lines = argumentParser.get<size_t>(LinesArgument);
+        strings.iterations = argumentParser.get<size_t>(IterationsArgument);
+
+        std::cout << "running snowcrash string helpers test...\n";
+        return snowcrashperf::RunStringsBenchmark(strings);
+    }
+
+    if (argumentParser.exist(ScalingArgument)) {
+
+        scaling.options = options;
+        scaling.runCount = argumentParser.exist(RunsArgument) ? argumentParser.get<int>(RunsArgument) : scaling.runCount;
+        scaling.steps = argumentParser.get<size_t>(StepsArgument);
+        scaling.maxExponent = argumentParser.get<double>(MaxExponentArgument);
+        scaling.base.groups = argumentParser.get<size_t>("groups");
+        scaling.base.resources = argumentParser.get<size_t>("resources");
+        scaling.base.actions = argumentParser.get<size_t>("actions");
+        scaling.base.examples = argumentParser.get<size_t>("examples");
+        scaling.base.parameters = argumentParser.get<size_t>("parameters");
+        scaling.base.modelReferences = argumentParser.get<size_t>("references");
+        scaling.base.bodySize = argumentParser.get<size_t>("body-size");
+
+        std::cout << "running snowcrash scaling test...\n";
+        return snowcrashperf::RunScalingBenchmark(scaling);
+    }
+
+    if (argumentParser.exist(ThreadsArgument)) {
+
+        threads.options = options;
+        threads.threads = argumentParser.get<size_t>(ThreadsArgument);
+        threads.runCount = argumentParser.exist(RunsArgument) ? argumentParser.get<int>(RunsArgument) : threads.runCount;
+
+        std::vector<std::string> inputs;
+
+        for (std::vector<std::string>::const_iterator it = argumentParser.rest().begin();
+             it != argumentParser.rest().end();
+             ++it) {
+
+            std::ifstream inputFileStream(it->c_str());
+            if (!inputFileStream.is_open()) {
+                std::cerr << "fatal: unable to open input file '" << *it << "'\n";
+                exit(EXIT_FAILURE);
+            }
+
+            std::stringstream inputStream;
+            inputStream << inputFileStream.rdbuf();
+            inputs.push_back(inputStream.str());
+        }
+
+        std::cout << "running snowcrash concurrent parsing test...\n";
+        return snowcrashperf::RunThreadsBenchmark(threads, inputs);
+    }
+
     if (argumentParser.rest().size() != 1) {
         std::cerr << "one input file expected\n";
         exit(EXIT_FAILURE);
@@ -149,14 +268,26 @@ int main(int argc, const char *argv[])
     
     std::cout << "running snowcrash performance test...\n";
     
-    double mean = 0, total = 0, stddev = 0;
-    int result = testfunc(inputStream.str(), total, mean, stddev);
+    int runCount = argumentParser.get<int>(RunsArgument);
+    snowcrashperf::Timing timing;
+    int result = snowcrashperf::MeasureParse(inputStream.str(), options, runCount, timing);
     
-    std::cout << "parsing '" << inputFileName << "' " << TestRunCount << "-times (" << result << "):\n";
-    std::cout << "total: " << total << "s mean: " << mean << " +/- " << stddev << "s\n";
+    std::cout << "parsing '" << inputFileName << "' " << runCount << "-times (" << result << "):\n";
+    std::cout << "total: " << timing.total << "s mean: " << timing.mean << " +/- " << timing.stddev << "s\n";
+
+    if (argumentParser.exist(WarmArgument)) {
+
+        snowcrash::Parser parser;
+        snowcrashperf::Timing warmTiming;
+        result = snowcrashperf::MeasureParse(inputStream.str(), options, runCount, warmTiming, &parser);
+
+        std::cout << "reusing parser " << runCount << "-times (" << result << "):\n";
+        std::cout << "total: " << warmTiming.total << "s mean: " << warmTiming.mean << " +/- " << warmTiming.stddev << "s\n";
+
+        if (warmTiming.total > 0)
+            std::cout << "cold / warm: " << timing.total / warmTiming.total << "x\n";
+    }
     
     // FIXME: Intstrumetns helper
     //::sleep(20);
 }
-
-
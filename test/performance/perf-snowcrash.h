@@ -0,0 +1,139 @@
+//
+//  perf-snowcrash.h
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_PERFSNOWCRASH_H
+#define SNOWCRASH_PERFSNOWCRASH_H
+
+#include <string>
+#include <vector>
+#include "snowcrash.h"
+#include "blueprint-generator.h"
+
+namespace snowcrashperf {
+
+    /** Time spent in repeated runs of a test (s) */
+    struct Timing {
+
+        Timing() : total(0), mean(0), stddev(0) {}
+
+        double total;
+        double mean;
+        double stddev;
+    };
+
+    /** \returns Wall clock time in seconds */
+    double Now();
+
+    /**
+     *  \brief  Parse input @runCount -times
+     *  \param  input       A blueprint source data.
+     *  \param  options     Parser options.
+     *  \param  runCount    Number of runs.
+     *  \param  timing      Time spent parsing.
+     *  \param  parser      Parser to reuse for every run, NULL to use snowcrash::parse.
+     *  \return Result code of the last parse operation.
+     */
+    int MeasureParse(const std::string& input,
+                     snowcrash::BlueprintParserOptions options,
+                     int runCount,
+                     Timing& timing,
+                     snowcrash::Parser* parser = NULL);
+
+    /** Scaling benchmark settings */
+    struct ScalingSettings {
+
+        ScalingSettings() : steps(5), runCount(5), maxExponent(1.2), options(0) {}
+
+        /** Shape of the smallest blueprint, groups are doubled in every step */
+        GeneratorSettings base;
+
+        /** Number of blueprint sizes */
+        size_t steps;
+
+        /** Number of parser runs per size */
+        int runCount;
+
+        /** Maximum acceptable growth exponent */
+        double maxExponent;
+
+        /** Parser options */
+        snowcrash::BlueprintParserOptions options;
+    };
+
+    /**
+     *  \brief  Measure how parsing time grows with blueprint size
+     *
+     *  Fits `time = a * size^k` and fails if `k` exceeds the acceptable exponent.
+     *
+     *  \return EXIT_SUCCESS if the growth is acceptable, EXIT_FAILURE otherwise.
+     */
+    int RunScalingBenchmark(const ScalingSettings& settings);
+
+    /** Routing benchmark settings */
+    struct RoutingSettings {
+
+        RoutingSettings() : lookups(100000) {}
+
+        /** Shape of the routed blueprint */
+        GeneratorSettings base;
+
+        /** Number of requests to resolve */
+        size_t lookups;
+    };
+
+    /**
+     *  \brief  Measure request routing with RouteIndex against trying every resource
+     *  \return EXIT_SUCCESS if every generated request resolves, EXIT_FAILURE otherwise.
+     */
+    int RunRoutingBenchmark(const RoutingSettings& settings);
+
+    /** String helpers benchmark settings */
+    struct StringsSettings {
+
+        StringsSettings() : lines(64), iterations(10000) {}
+
+        /** Number of `key: value` lines in the measured block */
+        size_t lines;
+
+        /** Number of runs of every helper */
+        size_t iterations;
+    };
+
+    /**
+     *  \brief  Measure the copying string helpers against their view-based equivalents
+     *  \return EXIT_SUCCESS if both variants yield the same results, EXIT_FAILURE otherwise.
+     */
+    int RunStringsBenchmark(const StringsSettings& settings);
+
+    /** Concurrent parsing benchmark settings */
+    struct ThreadsSettings {
+
+        ThreadsSettings() : threads(4), runCount(50), options(0) {}
+
+        /** Maximum number of threads, measured from one thread up */
+        size_t threads;
+
+        /** Number of parses of every input per thread */
+        int runCount;
+
+        /** Parser options */
+        snowcrash::BlueprintParserOptions options;
+    };
+
+    /**
+     *  \brief  Measure parsing throughput of 1 to N threads parsing the inputs at once
+     *
+     *  Every thread parses every input `runCount` times with its own parser,
+     *  the speedup is the throughput relative to a single thread.
+     *
+     *  \return EXIT_SUCCESS if every parse succeeds, EXIT_FAILURE otherwise.
+     */
+    int RunThreadsBenchmark(const ThreadsSettings& settings, const std::vector<std::string>& inputs);
+}
+
+#endif
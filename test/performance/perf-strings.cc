@@ -0,0 +1,155 @@
+//
+//  perf-strings.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include "StringUtility.h"
+#include "perf-snowcrash.h"
+
+using namespace snowcrashperf;
+using namespace snowcrash;
+
+/** \returns Block of `lines` HTTP-header-like `key: value` lines */
+static std::string GenerateKeyValueBlock(size_t lines)
+{
+    std::stringstream ss;
+
+    for (size_t i = 0; i < lines; ++i) {
+        ss << "  X-Header-" << i << " :  value " << i << "; charset=utf-8  \n";
+
+        if (i % 8 == 7)
+            ss << "\n";
+    }
+
+    return ss.str();
+}
+
+/** \returns Number of key-value pairs found using the copying helpers */
+static size_t CopyingKeyValues(const std::string& block)
+{
+    size_t count = 0;
+    std::vector<std::string> lines = Split(block, '\n');
+
+    for (std::vector<std::string>::iterator line = lines.begin(); line != lines.end(); ++line) {
+
+        if (TrimString(*line).empty())
+            continue;
+
+        std::vector<std::string> pair = SplitOnFirst(*line, ':');
+
+        if (pair.size() != 2)
+            continue;
+
+        TrimString(pair[0]);
+        TrimString(pair[1]);
+
+        if (!pair[0].empty() && !pair[1].empty())
+            ++count;
+    }
+
+    return count;
+}
+
+/** \returns Number of key-value pairs found using the views */
+static size_t ViewKeyValues(const std::string& block)
+{
+    size_t count = 0;
+    LineIterator lines((StringView(block)));
+    StringView line, key, value;
+
+    while (lines.next(line)) {
+
+        if (TrimView(line).empty())
+            continue;
+
+        if (SplitKeyValue(line, ':', key, value) && !key.empty() && !value.empty())
+            ++count;
+    }
+
+    return count;
+}
+
+/** \returns Total length of first lines extracted using `GetFirstLine()` */
+static size_t CopyingFirstLines(const std::string& block)
+{
+    std::string remaining;
+    return GetFirstLine(block, remaining).length() + remaining.length();
+}
+
+/** \returns Total length of first lines extracted using `FirstLineView()` */
+static size_t ViewFirstLines(const std::string& block)
+{
+    StringView remaining;
+    return FirstLineView(StringView(block), remaining).length + remaining.length;
+}
+
+/** Helper under measurement */
+typedef size_t (*StringHelper)(const std::string&);
+
+/** \returns Time spent running the helper @iterations-times (s), `result` set to its last result */
+static double MeasureHelper(StringHelper helper, const std::string& input, size_t iterations, size_t& result)
+{
+    double start = Now();
+
+    for (size_t i = 0; i < iterations; ++i) {
+        result = helper(input);
+    }
+
+    return Now() - start;
+}
+
+/** Prints one row of the comparison, returns false if the results differ */
+static bool Compare(const char* name,
+                    StringHelper copying,
+                    StringHelper view,
+                    const std::string& input,
+                    size_t iterations)
+{
+    size_t copyingResult = 0, viewResult = 0;
+    double copyingTime = MeasureHelper(copying, input, iterations, copyingResult);
+    double viewTime = MeasureHelper(view, input, iterations, viewResult);
+
+    std::cout << std::setw(12) << name
+              << std::setw(14) << (copyingTime * 1000000.0) / iterations
+              << std::setw(14) << (viewTime * 1000000.0) / iterations;
+
+    if (viewTime > 0)
+        std::cout << std::setw(10) << std::setprecision(3) << copyingTime / viewTime << "x";
+
+    std::cout << "\n";
+
+    return copyingResult == viewResult;
+}
+
+int snowcrashperf::RunStringsBenchmark(const StringsSettings& settings)
+{
+    if (settings.iterations == 0 || settings.lines == 0) {
+        std::cerr << "fatal: nothing to measure\n";
+        return EXIT_FAILURE;
+    }
+
+    std::string block = GenerateKeyValueBlock(settings.lines);
+
+    std::cout << "lines: " << settings.lines << " iterations: " << settings.iterations << "\n";
+    std::cout << std::setw(12) << "helper"
+              << std::setw(14) << "copy (us)"
+              << std::setw(14) << "view (us)"
+              << std::setw(11) << "speedup" << "\n";
+
+    bool match = Compare("key-value", CopyingKeyValues, ViewKeyValues, block, settings.iterations);
+    match = Compare("first line", CopyingFirstLines, ViewFirstLines, block, settings.iterations) && match;
+
+    if (!match) {
+        std::cerr << "fatal: copying and view helpers disagree\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,161 @@
+//
+//  perf-threads.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "perf-snowcrash.h"
+
+#if defined (_MSC_VER)
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+using namespace snowcrashperf;
+using namespace snowcrash;
+
+/** Work of a parsing thread, every thread parses every input `runCount` times */
+struct ParsingThread {
+
+    ParsingThread() : inputs(NULL), runCount(0), options(0), failures(0) {}
+
+    const std::vector<std::string>* inputs;
+    int runCount;
+    BlueprintParserOptions options;
+    int failures;
+
+#if defined (_MSC_VER)
+    HANDLE thread;
+#else
+    pthread_t thread;
+#endif
+
+    void run() {
+        Parser parser;
+
+        for (int i = 0; i < runCount; ++i) {
+            for (std::vector<std::string>::const_iterator it = inputs->begin(); it != inputs->end(); ++it) {
+                ParseResult<Blueprint> blueprint;
+                parser.parse(*it, options, blueprint);
+
+                if (blueprint.report.error.code != Error::OK)
+                    ++failures;
+            }
+        }
+    }
+
+#if defined (_MSC_VER)
+    static DWORD WINAPI start(LPVOID context) {
+        static_cast<ParsingThread*>(context)->run();
+        return 0;
+    }
+#else
+    static void* start(void* context) {
+        static_cast<ParsingThread*>(context)->run();
+        return NULL;
+    }
+#endif
+};
+
+/** Parse on `threads` threads at once, \returns false if a thread fails to start or a parse fails */
+static bool ParseConcurrently(const ThreadsSettings& settings,
+                              const std::vector<std::string>& inputs,
+                              size_t threads,
+                              double& time)
+{
+    std::vector<ParsingThread> workers(threads);
+    bool ok = true;
+
+    for (std::vector<ParsingThread>::iterator it = workers.begin(); it != workers.end(); ++it) {
+        it->inputs = &inputs;
+        it->runCount = settings.runCount;
+        it->options = settings.options;
+    }
+
+    double start = Now();
+    size_t started = 0;
+
+    for (; started < workers.size(); ++started) {
+        ParsingThread& worker = workers[started];
+
+#if defined (_MSC_VER)
+        worker.thread = ::CreateThread(NULL, 0, ParsingThread::start, &worker, 0, NULL);
+        if (worker.thread == NULL)
+            break;
+#else
+        if (::pthread_create(&worker.thread, NULL, ParsingThread::start, &worker) != 0)
+            break;
+#endif
+    }
+
+    for (size_t i = 0; i < started; ++i) {
+#if defined (_MSC_VER)
+        ::WaitForSingleObject(workers[i].thread, INFINITE);
+        ::CloseHandle(workers[i].thread);
+#else
+        ::pthread_join(workers[i].thread, NULL);
+#endif
+        if (workers[i].failures)
+            ok = false;
+    }
+
+    time = Now() - start;
+
+    if (started != workers.size()) {
+        std::cerr << "unable to start thread " << started + 1 << " of " << threads << "\n";
+        return false;
+    }
+
+    return ok;
+}
+
+int snowcrashperf::RunThreadsBenchmark(const ThreadsSettings& settings, const std::vector<std::string>& inputs)
+{
+    if (settings.threads == 0 || settings.runCount <= 0 || inputs.empty()) {
+        std::cerr << "at least one thread, run and input expected\n";
+        return EXIT_FAILURE;
+    }
+
+    std::cout << std::setw(8) << "threads"
+              << std::setw(12) << "parses"
+              << std::setw(12) << "time (s)"
+              << std::setw(14) << "parses / s"
+              << std::setw(10) << "speedup"
+              << std::setw(12) << "efficiency" << "\n";
+
+    double baseline = 0;
+
+    for (size_t threads = 1; threads <= settings.threads; ++threads) {
+
+        double time = 0;
+
+        if (!ParseConcurrently(settings, inputs, threads, time)) {
+            std::cerr << "parsing failed on " << threads << " threads\n";
+            return EXIT_FAILURE;
+        }
+
+        size_t parses = threads * settings.runCount * inputs.size();
+        double throughput = (time > 0) ? parses / time : 0;
+
+        if (threads == 1)
+            baseline = throughput;
+
+        double speedup = (baseline > 0) ? throughput / baseline : 0;
+
+        std::cout << std::setw(8) << threads
+                  << std::setw(12) << parses
+                  << std::setw(12) << std::fixed << std::setprecision(3) << time
+                  << std::setw(14) << std::setprecision(1) << throughput
+                  << std::setw(10) << std::setprecision(2) << speedup
+                  << std::setw(12) << std::setprecision(2) << speedup / threads << "\n";
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -46,6 +46,7 @@ TEST_CASE("Parsing action", "[action]")
 
     REQUIRE(action.node.name == "My Method");
     REQUIRE(action.node.method == "GET");
+    REQUIRE(action.node.methodType == GETHTTPMethodType);
     REQUIRE(action.node.description == "Method Description\n\n");
 
     REQUIRE(action.node.examples.size() == 1);
@@ -53,6 +54,7 @@ TEST_CASE("Parsing action", "[action]")
     REQUIRE(action.node.examples.front().responses.size() == 1);
 
     REQUIRE(action.node.examples.front().responses[0].name == "200");
+    REQUIRE(action.node.examples.front().responses[0].statusCode == 200);
     REQUIRE(action.node.examples.front().responses[0].body == "OK.\n");
     REQUIRE(action.node.examples.front().responses[0].headers.size() == 1);
     REQUIRE(action.node.examples.front().responses[0].headers[0].first == "Content-Type");
@@ -384,6 +386,7 @@ TEST_CASE("Give a warning when 2xx CONNECT has a body", "[action]")
     REQUIRE(action.report.warnings.size() == 1);
 
     REQUIRE(action.node.method == "CONNECT");
+    REQUIRE(action.node.methodType == CONNECTHTTPMethodType);
     REQUIRE(action.node.examples.size() == 1);
     REQUIRE(action.node.examples[0].responses.size() == 1);
     REQUIRE(action.node.examples[0].responses[0].body == "{}\n");
@@ -413,6 +416,7 @@ TEST_CASE("Give a warning when response to HEAD has a body", "[action]")
     REQUIRE(action.report.warnings[0].code == EmptyDefinitionWarning);
 
     REQUIRE(action.node.method == "HEAD");
+    REQUIRE(action.node.methodType == HEADHTTPMethodType);
     REQUIRE(action.node.examples.size() == 1);
     REQUIRE(action.node.examples[0].responses.size() == 1);
     REQUIRE(action.node.examples[0].responses[0].body == "{}\n");
@@ -427,6 +431,29 @@ TEST_CASE("Give a warning when response to HEAD has a body", "[action]")
     REQUIRE(action.sourceMap.examples.collection[0].responses.collection.size() == 1);
 }
 
+TEST_CASE("HTTP method types follow recognized HTTP request methods", "[action]")
+{
+    std::string methods = HTTP_REQUEST_METHOD;
+    methods = methods.substr(1, methods.length() - 2);
+
+    std::stringstream ss(methods);
+    std::string method;
+    int type = UndefinedHTTPMethodType;
+
+    while (std::getline(ss, method, '|')) {
+        REQUIRE(GetHTTPMethodType(method) == ++type);
+        REQUIRE(GetMethodTrait(static_cast<HTTPMethodType>(type)).method == method);
+    }
+
+    REQUIRE(type == CONNECTHTTPMethodType);
+    REQUIRE(GetHTTPMethodType("get") == UndefinedHTTPMethodType);
+    REQUIRE(GetHTTPMethodType("") == UndefinedHTTPMethodType);
+
+    REQUIRE_FALSE(GetMethodTrait(HEADHTTPMethodType).allowBody);
+    REQUIRE_FALSE(GetMethodTrait("CONNECT").allowBody);
+    REQUIRE(GetMethodTrait("GET").allowBody);
+}
+
 TEST_CASE("Missing 'LINK' HTTP request method", "[action]")
 {
     mdp::ByteBuffer source = \
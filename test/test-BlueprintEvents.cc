@@ -0,0 +1,221 @@
+//
+//  test-BlueprintEvents.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <algorithm>
+#include "snowcrashtest.h"
+#include "snowcrash.h"
+
+using namespace snowcrash;
+using namespace snowcrashtest;
+
+/** Records events as strings */
+class EventRecorder : public BlueprintEvents {
+public:
+    void record(const std::string& event) {
+        events.push_back(event);
+        log.push_back(event);
+    }
+
+    std::vector<std::string> events;
+    std::vector<Warning> warnings;
+
+    virtual void resourceGroupStart(const ResourceGroup& group) {
+        record("group " + group.name);
+    }
+
+    virtual void resourceGroupEnd(const ResourceGroup& group) {
+        record("end group " + group.name);
+    }
+
+    virtual void resourceStart(const Resource& resource) {
+        record("resource " + resource.uriTemplate);
+    }
+
+    virtual void resourceEnd(const Resource& resource) {
+        record("end resource " + resource.uriTemplate);
+    }
+
+    virtual void action(const Action& action) {
+        record("action " + action.method);
+    }
+
+    virtual void payload(const Payload& payload, SectionType type) {
+        if (type == ResponseSectionType || type == ResponseBodySectionType)
+            record("response " + payload.name);
+        else
+            record("payload " + payload.name);
+    }
+
+    virtual void parameter(const Parameter& parameter) {
+        record("parameter " + parameter.name);
+    }
+
+    virtual void warning(const Warning& warning) {
+        warnings.push_back(warning);
+        log.push_back("warning");
+    }
+
+    virtual void error(const Error& error) {
+        errors.push_back(error);
+    }
+
+    /** Entity events recorded before each warning, in order */
+    std::vector<std::string> log;
+
+    std::vector<Error> errors;
+};
+
+TEST_CASE("Emit blueprint events in source order", "[events]")
+{
+    mdp::ByteBuffer source = \
+    "# API\n\n"\
+    "# Group Notes\n\n"\
+    "## Note [/notes/{id}]\n\n"\
+    "+ Parameters\n"\
+    "    + id (number) ... Note identifier\n\n"\
+    "### Retrieve [GET]\n\n"\
+    "+ Response 200 (text/plain)\n\n"\
+    "        Hello\n\n"\
+    "## GET /status\n\n"\
+    "+ Response 204\n\n"\
+    "## POST /orphan\n";
+
+    EventRecorder recorder;
+    int result = parse(source, 0, recorder);
+
+    REQUIRE(result == Error::OK);
+    REQUIRE(recorder.events.size() == 14);
+    REQUIRE(recorder.events[0] == "group Notes");
+    REQUIRE(recorder.events[1] == "resource /notes/{id}");
+    REQUIRE(recorder.events[2] == "parameter id");
+    REQUIRE(recorder.events[3] == "response 200");
+    REQUIRE(recorder.events[4] == "action GET");
+    REQUIRE(recorder.events[5] == "end resource /notes/{id}");
+    REQUIRE(recorder.events[6] == "resource /status");
+    REQUIRE(recorder.events[7] == "response 204");
+    REQUIRE(recorder.events[8] == "action GET");
+    REQUIRE(recorder.events[9] == "end resource /status");
+    REQUIRE(recorder.events[10] == "resource /orphan");
+    REQUIRE(recorder.events[11] == "action POST");
+    REQUIRE(recorder.events[12] == "end resource /orphan");
+    REQUIRE(recorder.events[13] == "end group Notes");
+
+    REQUIRE(recorder.warnings.size() == 1);
+    REQUIRE(recorder.warnings[0].code == EmptyDefinitionWarning);
+}
+
+TEST_CASE("Events do not change the parsed blueprint", "[events]")
+{
+    mdp::ByteBuffer source = \
+    "# API\n\n"\
+    "# GET /a\n\n"\
+    "+ Response 200\n";
+
+    ParseResult<Blueprint> blueprint;
+    parse(source, 0, blueprint);
+
+    EventRecorder recorder;
+    parse(source, 0, recorder);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(recorder.warnings.size() == blueprint.report.warnings.size());
+    REQUIRE(recorder.events.size() == 6);
+    REQUIRE(recorder.events[0] == "group ");
+    REQUIRE(recorder.events[1] == "resource /a");
+    REQUIRE(recorder.events[5] == "end group ");
+}
+
+TEST_CASE("Emit warnings before the next event", "[events]")
+{
+    mdp::ByteBuffer source = \
+    "# API\n\n"\
+    "# Group A\n\n"\
+    "## GET /a\n\n"\
+    "+ Response 204\n\n"\
+    "        Hello\n\n"\
+    "## GET /b\n\n"\
+    "+ Response 200\n";
+
+    EventRecorder recorder;
+    int result = parse(source, 0, recorder);
+
+    REQUIRE(result == Error::OK);
+    REQUIRE(recorder.warnings.size() == 1);
+    REQUIRE(recorder.warnings[0].code == EmptyDefinitionWarning);
+
+    std::vector<std::string>::const_iterator warning = std::find(recorder.log.begin(), recorder.log.end(), "warning");
+    std::vector<std::string>::const_iterator next = std::find(recorder.log.begin(), recorder.log.end(), "resource /b");
+
+    REQUIRE(warning != recorder.log.end());
+    REQUIRE(warning < next);
+}
+
+/** Checks the group summary handed to the end of a group */
+class GroupSummaryRecorder : public EventRecorder {
+public:
+    ResourceGroup group;
+
+    virtual void resourceGroupEnd(const ResourceGroup& group) {
+        this->group = group;
+    }
+};
+
+TEST_CASE("Keep only a summary of the reported resources", "[events]")
+{
+    mdp::ByteBuffer source = \
+    "# API\n\n"\
+    "# Group A\n"\
+    "Group description\n\n"\
+    "## Note [/note]\n"\
+    "Note description\n\n"\
+    "### GET\n"\
+    "+ Response 200\n\n"\
+    "        Hello\n\n"\
+    "+ Response 201\n\n"\
+    "    [Later][]\n\n"\
+    "## Note [/note]\n\n"\
+    "## Later [/later]\n"\
+    "+ Model\n\n"\
+    "        World\n";
+
+    GroupSummaryRecorder recorder;
+    int result = parse(source, 0, recorder);
+
+    ParseResult<Blueprint> blueprint;
+    parse(source, 0, blueprint);
+
+    REQUIRE(result == Error::OK);
+    REQUIRE(recorder.errors.empty());
+    REQUIRE(recorder.warnings.size() == blueprint.report.warnings.size());
+    REQUIRE(recorder.warnings[0].code == DuplicateWarning);
+
+    REQUIRE(recorder.group.name == "A");
+    REQUIRE(recorder.group.resources.size() == 3);
+    REQUIRE(recorder.group.resources[0].uriTemplate == "/note");
+    REQUIRE(recorder.group.resources[0].description.empty());
+    REQUIRE(recorder.group.resources[0].actions.size() == 1);
+    REQUIRE(recorder.group.resources[0].actions[0].examples[0].responses.size() == 1);
+    REQUIRE(recorder.group.resources[0].actions[0].examples[0].responses[0].reference.id == "Later");
+    REQUIRE(recorder.group.resources[2].model.body.empty());
+}
+
+TEST_CASE("Report undefined references of reported payloads", "[events]")
+{
+    mdp::ByteBuffer source = \
+    "# API\n\n"\
+    "## GET /a\n\n"\
+    "+ Response 200\n\n"\
+    "    [Missing][]\n";
+
+    EventRecorder recorder;
+    int result = parse(source, 0, recorder);
+
+    REQUIRE(result == SymbolError);
+    REQUIRE(recorder.errors.size() == 1);
+    REQUIRE(recorder.errors[0].code == SymbolError);
+}
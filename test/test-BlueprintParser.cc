@@ -86,6 +86,30 @@ TEST_CASE("Parse canonical blueprint", "[blueprint]")
     REQUIRE(blueprint.sourceMap.resourceGroups.collection.size() == 2);
 }
 
+TEST_CASE("Source map policy overrides the parser options", "[blueprint]")
+{
+    ParseResult<Blueprint> exported;
+    SectionParserHelper<Blueprint, SourceMapBlueprintParser>::parse(BlueprintFixture, BlueprintSectionType, exported);
+
+    REQUIRE(exported.report.error.code == Error::OK);
+    REQUIRE(exported.sourceMap.name.sourceMap.size() == 1);
+    REQUIRE(exported.sourceMap.metadata.collection.size() == 1);
+    REQUIRE(exported.sourceMap.resourceGroups.collection.size() == 2);
+
+    ParseResult<Blueprint> plain;
+    SectionParserHelper<Blueprint, NoSourceMapBlueprintParser>::parse(BlueprintFixture, BlueprintSectionType, plain, ExportSourcemapOption);
+
+    REQUIRE(plain.report.error.code == Error::OK);
+    REQUIRE(plain.node.name == exported.node.name);
+    REQUIRE(plain.node.description == exported.node.description);
+    REQUIRE(plain.node.resourceGroups.size() == exported.node.resourceGroups.size());
+
+    REQUIRE(plain.sourceMap.name.sourceMap.empty());
+    REQUIRE(plain.sourceMap.description.sourceMap.empty());
+    REQUIRE(plain.sourceMap.metadata.collection.empty());
+    REQUIRE(plain.sourceMap.resourceGroups.collection.empty());
+}
+
 TEST_CASE("Parse blueprint with multiple metadata sections", "[blueprint]")
 {
     mdp::ByteBuffer source = "FORMAT: 1A\n\n";
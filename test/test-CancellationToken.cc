@@ -0,0 +1,167 @@
+//
+//  test-CancellationToken.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <sstream>
+#include "snowcrashtest.h"
+#include "snowcrash.h"
+#include "csnowcrash.h"
+
+using namespace snowcrash;
+using namespace snowcrashtest;
+
+static const mdp::ByteBuffer CancellationFixture = \
+"# API\n\n"\
+"## Notes [/notes]\n\n"\
+"### GET\n\n"\
+"+ Response 200 (text/plain)\n\n"\
+"        Hello World!\n";
+
+TEST_CASE("Token is not cancelled by default", "[cancellation]")
+{
+    CancellationToken token;
+
+    REQUIRE(!token.isCancelled());
+    REQUIRE(!token.isExpired());
+    REQUIRE_NOTHROW(token.check());
+
+    token.setTimeout(0);
+    REQUIRE(!token.isExpired());
+}
+
+TEST_CASE("Cancelled token throws on check", "[cancellation]")
+{
+    CancellationToken token;
+    token.cancel();
+
+    REQUIRE(token.isCancelled());
+
+    int code = Error::OK;
+
+    try {
+        token.check();
+    }
+    catch (const CancellationException& e) {
+        code = e.code;
+    }
+
+    REQUIRE(code == CancelledError);
+}
+
+TEST_CASE("Parse with an unused token", "[cancellation]")
+{
+    ParseResult<Blueprint> blueprint;
+    CancellationToken token;
+    token.setTimeout(60000);
+
+    parse(CancellationFixture, 0, blueprint, token);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(blueprint.report.warnings.empty());
+    REQUIRE(blueprint.node.resourceGroups.size() == 1);
+}
+
+TEST_CASE("Parse with a cancelled token", "[cancellation]")
+{
+    ParseResult<Blueprint> blueprint;
+    CancellationToken token;
+    token.cancel();
+
+    parse(CancellationFixture, 0, blueprint, token);
+
+    REQUIRE(blueprint.report.error.code == CancelledError);
+    REQUIRE(blueprint.node.resourceGroups.empty());
+}
+
+TEST_CASE("Parse with an expired deadline", "[cancellation]")
+{
+    ParseResult<Blueprint> blueprint;
+    CancellationToken token;
+    token.setTimeout(1);
+
+    // Busy wait for the deadline to pass
+    while (!token.isExpired()) {}
+
+    parse(CancellationFixture, 0, blueprint, token);
+
+    REQUIRE(blueprint.report.error.code == DeadlineExceededError);
+}
+
+TEST_CASE("Parse with a cancelled token through C interface", "[cancellation]")
+{
+    sc_cancellation_token_t* token = sc_cancellation_token_new();
+    sc_cancellation_token_cancel(token);
+
+    REQUIRE(sc_cancellation_token_is_cancelled(token) == 1);
+
+    sc_report_t* report = NULL;
+    sc_blueprint_t* blueprint = NULL;
+    sc_sm_blueprint_t* sourcemap = NULL;
+
+    int result = sc_c_parse_cancellable(CancellationFixture.c_str(), 0, token, &report, &blueprint, &sourcemap);
+
+    REQUIRE(result == SC_CANCELLED_ERROR);
+
+    sc_blueprint_free(blueprint);
+    sc_sm_blueprint_free(sourcemap);
+    sc_report_free(report);
+    sc_cancellation_token_free(token);
+}
+
+#if !defined(_WIN32)
+
+#include <pthread.h>
+#include <unistd.h>
+
+/** Cancel the token after a while, from a thread of its own */
+static void* CancelLater(void* context)
+{
+    ::usleep(2000);
+    static_cast<CancellationToken*>(context)->cancel();
+    return NULL;
+}
+
+/** \returns A blueprint with `resources` resources */
+static mdp::ByteBuffer LargeBlueprint(int resources)
+{
+    std::stringstream source;
+    source << "# API\n\n";
+
+    for (int i = 0; i < resources; ++i) {
+        source << "## R" << i << " [/r/" << i << "/{id}]\n\n";
+        source << "+ Parameters\n    + id ... Id\n\n";
+        source << "### Retrieve [GET]\n\n";
+        source << "+ Response 200 (application/json)\n\n        { \"id\": " << i << " }\n\n";
+    }
+
+    return source.str();
+}
+
+TEST_CASE("Cancel parsing from another thread", "[cancellation][concurrency]")
+{
+    int code = Error::OK;
+
+    // Grow the blueprint until parsing outlasts the delay of the cancelling thread
+    for (int resources = 1000; resources <= 64000 && code == Error::OK; resources *= 2) {
+
+        mdp::ByteBuffer source = LargeBlueprint(resources);
+        ParseResult<Blueprint> blueprint;
+        CancellationToken token;
+        pthread_t thread;
+
+        REQUIRE(pthread_create(&thread, NULL, CancelLater, &token) == 0);
+        parse(source, ExportSourcemapOption, blueprint, token);
+        pthread_join(thread, NULL);
+
+        code = blueprint.report.error.code;
+        REQUIRE((code == Error::OK || code == CancelledError));
+    }
+
+    REQUIRE(code == CancelledError);
+}
+
+#endif
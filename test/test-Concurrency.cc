@@ -0,0 +1,233 @@
+//
+//  test-Concurrency.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <sstream>
+#include "snowcrashtest.h"
+#include "snowcrash.h"
+#include "csnowcrash.h"
+#include "SerializeJSON.h"
+#include "SerializeYAML.h"
+
+using namespace snowcrash;
+using namespace snowcrashtest;
+
+TEST_CASE("Serialize resource groups on more threads", "[concurrency]")
+{
+    std::stringstream source;
+    source << "# API\n\n";
+
+    for (int i = 0; i < 6; ++i) {
+        source << "# Group G" << i << "\n\n";
+        source << "## R" << i << " [/r/" << i << "/{id}]\n\n";
+        source << "+ Parameters\n    + id ... Id\n\n";
+        source << "### Retrieve [GET]\n\n";
+        source << "+ Response 200 (application/json)\n\n        { \"group\": " << i << " }\n\n";
+    }
+
+    ParseResult<Blueprint> blueprint;
+    parse(source.str(), ExportSourcemapOption, blueprint);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(blueprint.node.resourceGroups.size() == 6);
+
+    std::stringstream json, smJSON, yaml, smYAML;
+    SerializeJSON(blueprint.node, json);
+    SerializeSourceMapJSON(blueprint.sourceMap, smJSON);
+    SerializeYAML(blueprint.node, yaml);
+    SerializeSourceMapYAML(blueprint.sourceMap, smYAML);
+
+    for (size_t threads = 2; threads <= 8; threads *= 2) {
+        std::stringstream parallelJSON, parallelSMJSON, parallelYAML, parallelSMYAML;
+        SerializeJSON(blueprint.node, parallelJSON, threads);
+        SerializeSourceMapJSON(blueprint.sourceMap, parallelSMJSON, threads);
+        SerializeYAML(blueprint.node, parallelYAML, threads);
+        SerializeSourceMapYAML(blueprint.sourceMap, parallelSMYAML, threads);
+
+        REQUIRE(parallelJSON.str() == json.str());
+        REQUIRE(parallelSMJSON.str() == smJSON.str());
+        REQUIRE(parallelYAML.str() == yaml.str());
+        REQUIRE(parallelSMYAML.str() == smYAML.str());
+    }
+}
+
+#if !defined(_WIN32)
+
+#include <pthread.h>
+
+static const int ThreadCount = 8;
+static const int ParseCount = 20;
+
+/** Blueprint exercising symbols, lazy references, headers, parameters and warnings */
+static const mdp::ByteBuffer ConcurrencyFixture = \
+"FORMAT: 1A\n\n"\
+"# API\n\n"\
+"# Group Notes\n\n"\
+"## Note [/notes/{id}]\n\n"\
+"+ Parameters\n"\
+"    + id (number, `1`) ... Note id\n\n"\
+"### Retrieve [GET]\n\n"\
+"+ Response 200\n\n"\
+"    [Collection][]\n\n"\
+"### Update [PUT]\n\n"\
+"+ Request (application/json)\n\n"\
+"    + Headers\n\n"\
+"            Set-Cookie: a=1\n"\
+"            Set-Cookie: b=2\n"\
+"            Accept: text/plain\n"\
+"            Accept: text/html\n\n"\
+"    + Body\n\n"\
+"            { \"id\": 1 }\n\n"\
+"+ Response 204\n\n"\
+"        unexpected body\n\n"\
+"## Collection [/notes]\n\n"\
+"+ Model (application/json)\n\n"\
+"        [ { \"id\": 1 } ]\n\n"\
+"### List [GET]\n\n"\
+"+ Response 200\n\n"\
+"    [Collection][]\n";
+
+/** \returns JSON serialization of the AST, source map and report of a parse */
+static std::string SerializeResult(const ParseResult<Blueprint>& result)
+{
+    std::stringstream ss;
+    SerializeJSON(result.node, ss);
+    SerializeSourceMapJSON(result.sourceMap, ss);
+    ss << result.report.error.code << ":" << result.report.warnings.size();
+
+    for (Warnings::const_iterator it = result.report.warnings.begin(); it != result.report.warnings.end(); ++it)
+        ss << "\n" << it->code << " " << it->message;
+
+    return ss.str();
+}
+
+/** Work of a parsing thread */
+struct ParseThread {
+
+    ParseThread() : cancellation(NULL), canceller(NULL), reuseParser(false), useCInterface(false), mismatches(0), cancelled(0) {}
+
+    std::string expected;
+    const CancellationToken* cancellation;
+    CancellationToken* canceller;   /// < Token to cancel half way through, NULL if none
+    bool reuseParser;
+    bool useCInterface;
+    int mismatches;
+    int cancelled;
+
+    pthread_t thread;
+
+    void run() {
+        Parser parser;
+
+        for (int i = 0; i < ParseCount; ++i) {
+
+            if (canceller && i == ParseCount / 2)
+                canceller->cancel();
+
+            if (useCInterface) {
+                sc_parse_result_t* result;
+                const sc_report_t* report;
+                const sc_blueprint_t* blueprint;
+
+                sc_c_parse_v2(ConcurrencyFixture.c_str(), ConcurrencyFixture.length(), 0, &result, &report, &blueprint, NULL);
+
+                if (std::string(sc_blueprint_name(blueprint)) != "API" ||
+                    sc_warnings_size(sc_warnings_handler(report)) == 0)
+                    ++mismatches;
+
+                sc_parse_result_free(result);
+                continue;
+            }
+
+            ParseResult<Blueprint> result;
+
+            if (reuseParser)
+                parser.parse(ConcurrencyFixture, ExportSourcemapOption, result, cancellation);
+            else if (cancellation)
+                parse(ConcurrencyFixture, ExportSourcemapOption, result, *cancellation);
+            else
+                parse(ConcurrencyFixture, ExportSourcemapOption, result);
+
+            if (cancellation && result.report.error.code == CancelledError)
+                ++cancelled;
+            else if (SerializeResult(result) != expected)
+                ++mismatches;
+        }
+    }
+
+    static void* start(void* context) {
+        static_cast<ParseThread*>(context)->run();
+        return NULL;
+    }
+};
+
+/** Run the threads, \returns total of their mismatches */
+static int RunThreads(std::vector<ParseThread>& threads)
+{
+    for (std::vector<ParseThread>::iterator it = threads.begin(); it != threads.end(); ++it)
+        REQUIRE(pthread_create(&it->thread, NULL, ParseThread::start, &*it) == 0);
+
+    int mismatches = 0;
+
+    for (std::vector<ParseThread>::iterator it = threads.begin(); it != threads.end(); ++it) {
+        pthread_join(it->thread, NULL);
+        mismatches += it->mismatches;
+    }
+
+    return mismatches;
+}
+
+TEST_CASE("Parse concurrently from more threads", "[concurrency]")
+{
+    ParseResult<Blueprint> baseline;
+    parse(ConcurrencyFixture, ExportSourcemapOption, baseline);
+
+    REQUIRE(baseline.report.error.code == Error::OK);
+    REQUIRE(!baseline.report.warnings.empty());
+
+    std::vector<ParseThread> threads(ThreadCount);
+
+    for (size_t i = 0; i < threads.size(); ++i)
+        threads[i].expected = SerializeResult(baseline);
+
+    REQUIRE(RunThreads(threads) == 0);
+}
+
+TEST_CASE("Parse concurrently with per-thread parsers and a shared cancellation token", "[concurrency]")
+{
+    ParseResult<Blueprint> baseline;
+    parse(ConcurrencyFixture, ExportSourcemapOption, baseline);
+
+    CancellationToken token;
+    std::vector<ParseThread> threads(ThreadCount);
+
+    for (size_t i = 0; i < threads.size(); ++i) {
+        threads[i].expected = SerializeResult(baseline);
+        threads[i].cancellation = &token;
+        threads[i].reuseParser = (i % 2 == 0);
+    }
+
+    // Cancel while the other threads are parsing
+    threads[0].canceller = &token;
+
+    REQUIRE(RunThreads(threads) == 0);
+
+    // The canceller itself sees the cancellation in its remaining parses
+    REQUIRE(threads[0].cancelled == ParseCount - ParseCount / 2);
+}
+
+TEST_CASE("Parse concurrently with C interface", "[concurrency][cinterface]")
+{
+    std::vector<ParseThread> threads(ThreadCount);
+
+    for (size_t i = 0; i < threads.size(); ++i)
+        threads[i].useCInterface = true;
+
+    REQUIRE(RunThreads(threads) == 0);
+}
+
+#endif
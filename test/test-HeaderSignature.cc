@@ -0,0 +1,77 @@
+//
+//  test-HeaderSignature.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "snowcrashtest.h"
+#include "HeaderSignature.h"
+
+using namespace snowcrash;
+using namespace snowcrashtest;
+
+TEST_CASE("Scan resource headers", "[header_signature]")
+{
+    mdp::ByteBuffer text = "GET /notes/{id}";
+    HeaderSignature signature;
+
+    REQUIRE(ScanResourceHeader(text, signature));
+    REQUIRE(HeaderSignature::part(text, signature.method) == "GET");
+    REQUIRE(HeaderSignature::part(text, signature.uriTemplate) == "/notes/{id}");
+
+    text = "Notes Collection [/notes]";
+    signature = HeaderSignature();
+
+    REQUIRE(!ScanResourceHeader(text, signature));
+    REQUIRE(ScanNamedResourceHeader(text, signature));
+    REQUIRE(HeaderSignature::part(text, signature.name) == "Notes Collection");
+    REQUIRE(HeaderSignature::part(text, signature.uriTemplate) == "/notes");
+
+    REQUIRE(!ScanResourceHeader("GET/notes", signature));
+    REQUIRE(!ScanNamedResourceHeader("Notes[/notes]", signature));
+    REQUIRE(!ScanNamedResourceHeader("Notes (draft) [/notes]", signature));
+}
+
+TEST_CASE("Scan action headers", "[header_signature]")
+{
+    mdp::ByteBuffer text = "  PROPPATCH";
+    HeaderSignature signature;
+
+    REQUIRE(ScanActionHeader(text, signature));
+    REQUIRE(HeaderSignature::part(text, signature.method) == "PROPPATCH");
+    REQUIRE(signature.uriTemplate.length == 0);
+
+    text = "Retrieve a Note [GET]";
+    signature = HeaderSignature();
+
+    REQUIRE(ScanNamedActionHeader(text, signature));
+    REQUIRE(HeaderSignature::part(text, signature.name) == "Retrieve a Note");
+    REQUIRE(HeaderSignature::part(text, signature.method) == "GET");
+
+    REQUIRE(!ScanActionHeader("GETS", signature));
+    REQUIRE(!ScanActionHeader("get /notes", signature));
+    REQUIRE(!ScanNamedActionHeader("[GET]", signature));
+    REQUIRE(!ScanNamedActionHeader("Retrieve [GET] now", signature));
+}
+
+TEST_CASE("Scan keyword headers", "[header_signature]")
+{
+    mdp::ByteBuffer text = "group  Notes ";
+    HeaderSignature signature;
+
+    REQUIRE(ScanGroupHeader(text, signature));
+    REQUIRE(HeaderSignature::part(text, signature.name) == "Notes");
+
+    text = "Structure Note";
+    signature = HeaderSignature();
+
+    REQUIRE(ScanDataStructureHeader(text, signature));
+    REQUIRE(HeaderSignature::part(text, signature.name) == "Note");
+
+    REQUIRE(!ScanGroupHeader("Groups", signature));
+    REQUIRE(!ScanGroupHeader("Group", signature));
+    REQUIRE(!ScanGroupHeader("Group [Notes]", signature));
+    REQUIRE(!ScanDataStructureHeader("Structure", signature));
+}
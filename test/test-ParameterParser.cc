@@ -563,3 +563,60 @@ TEST_CASE("Parameter with list in description", "[parameter]")
     REQUIRE(parameter.sourceMap.description.sourceMap[5].length == 21);
     REQUIRE(parameter.sourceMap.values.collection.empty());
 }
+
+TEST_CASE("Parse parameter signature components", "[parameter]")
+{
+    Parameter parameter;
+    ParameterSignatureComponents components;
+
+    REQUIRE(ParseParameterSignature("id = `1` (Optional, number, `42`) ... The id", parameter, components));
+    REQUIRE(parameter.name == "id");
+    REQUIRE(parameter.defaultValue == "1");
+    REQUIRE(parameter.use == OptionalParameterUse);
+    REQUIRE(parameter.type == "number");
+    REQUIRE(parameter.exampleValue == "42");
+    REQUIRE(parameter.description == "The id");
+    REQUIRE(components == (ExampleValueParameterComponent | UseParameterComponent | TypeParameterComponent));
+}
+
+TEST_CASE("Parse parameter signature with invalid traits", "[parameter]")
+{
+    Parameter parameter;
+    ParameterSignatureComponents components;
+
+    REQUIRE(ParseParameterSignature("id (required, string, number)", parameter, components));
+    REQUIRE(parameter.name == "id");
+    REQUIRE(parameter.type.empty());
+    REQUIRE(parameter.use == UndefinedParameterUse);
+    REQUIRE(components == InvalidTraitsParameterComponent);
+
+    REQUIRE(!IsValidParameterSignature("id (required"));
+    REQUIRE(!IsValidParameterSignature("id = 1"));
+    REQUIRE(!IsValidParameterSignature("i d"));
+    REQUIRE(!IsValidParameterSignature("id%2"));
+    REQUIRE(IsValidParameterSignature("id = `1`"));
+}
+
+TEST_CASE("Parse bare parameter names", "[parameter]")
+{
+    Parameter parameter;
+    ParameterSignatureComponents components;
+
+    REQUIRE(ParseParameterSignature("%5Bid%5D", parameter, components));
+    REQUIRE(parameter.name == "%5Bid%5D");
+    REQUIRE(parameter.use == UndefinedParameterUse);
+    REQUIRE(components == NoParameterComponent);
+
+    REQUIRE(IsValidParameterSignature("id"));
+    REQUIRE(IsValidParameterSignature("user.name-2[]"));
+    REQUIRE(!IsValidParameterSignature(":]"));
+    REQUIRE(!IsValidParameterSignature("\\]"));
+    REQUIRE(!IsValidParameterSignature("id%2"));
+
+    ParseResult<Parameter> bare;
+    SectionParserHelper<Parameter, ParameterParser>::parse("+ id\n", ParameterSectionType, bare);
+
+    REQUIRE(bare.report.error.code == Error::OK);
+    REQUIRE(bare.report.warnings.empty());
+    REQUIRE(bare.node.name == "id");
+}
@@ -0,0 +1,120 @@
+//
+//  test-ParseStatistics.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <sstream>
+#include "snowcrashtest.h"
+#include "snowcrash.h"
+#include "CParseStatistics.h"
+
+using namespace snowcrash;
+using namespace snowcrashtest;
+
+static const mdp::ByteBuffer StatisticsFixture = \
+"# API\n\n"\
+"# Group Notes\n\n"\
+"## Notes [/notes/{id}]\n\n"\
+"### GET\n\n"\
+"+ Response 200 (text/plain)\n\n"\
+"        Hello World!\n\n"\
+"## Notes [/notes/{id}]\n";
+
+TEST_CASE("Parse with statistics", "[statistics]")
+{
+    ParseResult<Blueprint> blueprint;
+    ParseStatistics statistics;
+
+    parse(StatisticsFixture, 0, blueprint, &statistics);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(blueprint.report.warnings.size() == 1);
+
+    if (!ParseStatistics::isAvailable()) {
+
+        REQUIRE(statistics.parsers.empty());
+        REQUIRE(statistics.nodes.empty());
+        REQUIRE(statistics.regex.empty());
+        REQUIRE(statistics.warnings.empty());
+        REQUIRE(statistics.spans.empty());
+        return;
+    }
+
+    REQUIRE(statistics.warnings.size() == 1);
+    REQUIRE(statistics.warnings[DuplicateWarning] == 1);
+
+    REQUIRE(statistics.nodes[ResourceGroupSectionType] == 1);
+    REQUIRE(statistics.nodes[ResourceSectionType] == 2);
+    REQUIRE(statistics.nodes[ActionSectionType] == 1);
+
+    REQUIRE(!statistics.regex.empty());
+    REQUIRE(statistics.parsers["snowcrash::parse"].calls == 1);
+    REQUIRE(statistics.parsers["mdp::MarkdownParser::parse"].calls == 1);
+
+    REQUIRE(!statistics.spans.empty());
+    REQUIRE(statistics.spans.back().name == "snowcrash::parse");
+    REQUIRE(statistics.spans.front().start >= statistics.spans.back().start);
+}
+
+TEST_CASE("Parse without statistics does not collect any", "[statistics]")
+{
+    ParseResult<Blueprint> blueprint;
+    ParseStatistics statistics;
+    ActiveParseStatistics active(&statistics);
+
+    parse(StatisticsFixture, 0, blueprint);
+
+    REQUIRE(blueprint.report.warnings.size() == 1);
+    REQUIRE(statistics.parsers.empty());
+    REQUIRE(statistics.warnings.empty());
+    REQUIRE(ParseStatistics::active() == &statistics);
+}
+
+TEST_CASE("Serialize trace spans as Chrome trace events", "[statistics]")
+{
+    ParseStatistics statistics;
+
+    statistics.addSpan("inner \"quoted\"", 1100, 1200);
+    statistics.addSpan("outer", 1000, 1500);
+
+    REQUIRE(statistics.spans.size() == 2);
+    REQUIRE(statistics.spans[0].start == 1100);
+    REQUIRE(statistics.spans[0].duration == 100);
+
+    std::stringstream ss;
+    SerializeTraceEventsJSON(statistics, ss);
+
+    REQUIRE(ss.str() == \
+            "{\n"\
+            "  \"traceEvents\": [\n"\
+            "    { \"name\": \"inner \\\"quoted\\\"\", \"cat\": \"snowcrash\", \"ph\": \"X\", \"ts\": 100.000, \"dur\": 100.000, \"pid\": 1, \"tid\": 1 },\n"\
+            "    { \"name\": \"outer\", \"cat\": \"snowcrash\", \"ph\": \"X\", \"ts\": 0.000, \"dur\": 500.000, \"pid\": 1, \"tid\": 1 }\n"\
+            "  ],\n"\
+            "  \"displayTimeUnit\": \"ms\"\n"\
+            "}\n");
+}
+
+TEST_CASE("Export statistics with C interface", "[statistics][cinterface]")
+{
+    sc_parse_statistics_t* statistics = sc_parse_statistics_new();
+
+    size_t length = sc_parse_statistics_json(statistics, NULL, 0);
+    REQUIRE(length > 0);
+
+    std::vector<char> buffer(length + 1);
+    REQUIRE(sc_parse_statistics_json(statistics, &buffer[0], buffer.size()) == length);
+
+    std::string json(&buffer[0]);
+    REQUIRE(json.length() == length);
+    REQUIRE(json.find("\"available\": ") != std::string::npos);
+    REQUIRE(json.find("\"regex\": [\n  ]") != std::string::npos);
+
+    char truncated[8];
+    REQUIRE(sc_parse_statistics_json(statistics, truncated, sizeof(truncated)) == length);
+    REQUIRE(std::string(truncated) == json.substr(0, 7));
+
+    sc_parse_statistics_free(statistics);
+}
@@ -216,6 +216,25 @@ TEST_CASE("Parse abbreviated inline payload body", "[payload]")
     REQUIRE(payload.sourceMap.body.sourceMap[1].length == 2);
 }
 
+TEST_CASE("Materialize payload assets from source map", "[payload]")
+{
+    mdp::ByteBuffer source = RequestBodyFixture;
+    source += "  B\n";
+
+    ParseResult<Payload> payload, full;
+    SectionParserHelper<Payload, PayloadParser>::parse(RequestFixture, RequestSectionType, full, ExportSourcemapOption);
+    SectionParserHelper<Payload, PayloadParser>::parse(source, RequestBodySectionType, payload, ExportSourcemapOption);
+
+    mdp::ByteBuffer body, schema, inlineBody;
+    CodeBlockUtility::appendAsset(full.sourceMap.body.sourceMap, RequestFixture, body);
+    CodeBlockUtility::appendAsset(full.sourceMap.schema.sourceMap, RequestFixture, schema);
+    CodeBlockUtility::appendAsset(payload.sourceMap.body.sourceMap, source, inlineBody);
+
+    REQUIRE(body == full.node.body);
+    REQUIRE(schema == full.node.schema);
+    REQUIRE(inlineBody == payload.node.body);
+}
+
 TEST_CASE("Parse payload description with list", "[payload]")
 {
     // Blueprint in question:
@@ -621,9 +640,36 @@ TEST_CASE("Give a warning when 100 response has a body", "[payload]")
     REQUIRE(payload.report.warnings.size() == 1);
     REQUIRE(payload.report.warnings[0].code == EmptyDefinitionWarning);
 
+    REQUIRE(payload.node.name == "100");
+    REQUIRE(payload.node.statusCode == 100);
     REQUIRE(payload.node.body == "{}\n");
 }
 
+TEST_CASE("Parse response status code", "[payload]")
+{
+    mdp::ByteBuffer source = "+ Response\n\n        {}\n";
+
+    ParseResult<Payload> response;
+    SectionParserHelper<Payload, PayloadParser>::parse(source, ResponseBodySectionType, response);
+
+    REQUIRE(response.report.error.code == Error::OK);
+    REQUIRE(response.report.warnings.size() == 1);
+    REQUIRE(response.report.warnings[0].code == EmptyDefinitionWarning);
+
+    REQUIRE(response.node.name == "200");
+    REQUIRE(response.node.statusCode == 200);
+
+    ParseResult<Payload> request;
+    SectionParserHelper<Payload, PayloadParser>::parse(RequestFixture, RequestSectionType, request);
+
+    REQUIRE(request.report.error.code == Error::OK);
+    REQUIRE(request.node.statusCode == 0);
+
+    REQUIRE(GetHTTPStatusCode("404") == 404);
+    REQUIRE(GetHTTPStatusCode("Hello") == 0);
+    REQUIRE(GetHTTPStatusCode("") == 0);
+}
+
 TEST_CASE("Empty body section should shouldn't be parsed as description", "[payload]")
 {
     ParseResult<Payload> payload;
@@ -688,3 +734,56 @@ TEST_CASE("Report ignoring nested request objects", "[payload][#163][#189]")
     REQUIRE(payload.node.headers.size() == 1);
     REQUIRE(payload.node.body.empty());
 }
+
+TEST_CASE("Classify payload signatures", "[payload]")
+{
+    mdp::ByteBuffer text = "  Response 201 (application/json)  \nCreated";
+    ClassifiedPayloadSignature classified = ClassifyPayloadSignature(text);
+
+    REQUIRE(classified.signature == ResponsePayloadSignature);
+    REQUIRE(!classified.hasRemainder);
+    REQUIRE(text.substr(classified.identifier.location, classified.identifier.length) == "201");
+    REQUIRE(text.substr(classified.mediaType.location, classified.mediaType.length) == "application/json");
+
+    text = "Note Model (text/plain)";
+    classified = ClassifyPayloadSignature(text);
+
+    REQUIRE(classified.signature == ModelPayloadSignature);
+    REQUIRE(text.substr(classified.identifier.location, classified.identifier.length) == "Note");
+    REQUIRE(text.substr(classified.mediaType.location, classified.mediaType.length) == "text/plain");
+
+    text = "Request Create [Note]";
+    classified = ClassifyPayloadSignature(text);
+
+    REQUIRE(classified.signature == RequestPayloadSignature);
+    REQUIRE(classified.hasRemainder);
+
+    REQUIRE(ClassifyPayloadSignature("Sample").signature == SamplePayloadSignature);
+    REQUIRE(ClassifyPayloadSignature("Note [Model]").signature == NoPayloadSignature);
+    REQUIRE(ClassifyPayloadSignature("Headers").signature == NoPayloadSignature);
+}
+
+TEST_CASE("Reuse payload signature classification of the same text", "[payload]")
+{
+    mdp::ByteBuffer response = "Response 201 (application/json)";
+    mdp::ByteBuffer request = "Request Create";
+
+    PayloadSignatureCache cache;
+
+    {
+        ActivePayloadSignatureCache active(cache);
+
+        REQUIRE(ClassifyPayloadSignature(response).signature == ResponsePayloadSignature);
+        REQUIRE(cache.text == &response);
+
+        ClassifiedPayloadSignature classified = ClassifyPayloadSignature(response);
+
+        REQUIRE(classified.signature == ResponsePayloadSignature);
+        REQUIRE(response.substr(classified.identifier.location, classified.identifier.length) == "201");
+
+        REQUIRE(ClassifyPayloadSignature(request).signature == RequestPayloadSignature);
+        REQUIRE(cache.text == &request);
+    }
+
+    REQUIRE(PayloadSignatureCache::active() == NULL);
+}
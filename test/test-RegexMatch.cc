@@ -33,3 +33,24 @@ TEST_CASE("regexmatch/request-payload", "Match request payload test")
 {
     REQUIRE(RegexMatch("Request My Id (application/json)", "^[Rr]equest([[:space:]]+([A-Za-z0-9_]|[[:space:]])*)?([[:space:]]\\([^\\)]*\\))?$") == true);
 }
+
+TEST_CASE("regexmatch/cache", "Compile expressions once while a cache is active")
+{
+    RegexCache cache;
+
+    {
+        ActiveRegexCache active(cache);
+
+        for (int i = 0; i < 2; ++i) {
+            REQUIRE(RegexMatch("HEAD /resource/{id}", "^((GET|HEAD)[[:space:]]+)?/.*$") == true);
+            REQUIRE(RegexMatch("/resource", "^GET") == false);
+            REQUIRE(RegexCaptureFirst("Request My Id", "^Request[[:space:]]+(.*)$") == "My Id");
+            REQUIRE(RegexMatch("target", "(") == false);
+        }
+
+        REQUIRE(RegexCache::active() == &cache);
+    }
+
+    REQUIRE(RegexCache::active() == NULL);
+    REQUIRE(RegexMatch("HEAD /resource/{id}", "^((GET|HEAD)[[:space:]]+)?/.*$") == true);
+}
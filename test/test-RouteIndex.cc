@@ -0,0 +1,194 @@
+//
+//  test-RouteIndex.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "snowcrashtest.h"
+#include "RouteIndex.h"
+#include "CRouteIndex.h"
+
+using namespace snowcrash;
+using namespace snowcrashtest;
+
+/** Add resource with actions of given methods to the last group */
+static void AddResource(Blueprint& blueprint, const URITemplate& uriTemplate, const char* methods[], size_t count)
+{
+    if (blueprint.resourceGroups.empty())
+        blueprint.resourceGroups.push_back(ResourceGroup());
+
+    Resource resource;
+    resource.uriTemplate = uriTemplate;
+
+    for (size_t i = 0; i < count; ++i) {
+
+        Action action;
+        action.method = methods[i];
+        resource.actions.push_back(action);
+    }
+
+    blueprint.resourceGroups.back().resources.push_back(resource);
+}
+
+static void AddResource(Blueprint& blueprint, const URITemplate& uriTemplate, const char* method)
+{
+    const char* methods[] = { method };
+    AddResource(blueprint, uriTemplate, methods, 1);
+}
+
+TEST_CASE("Route literal paths", "[routing]")
+{
+    Blueprint blueprint;
+    const char* methods[] = { "GET", "POST" };
+    AddResource(blueprint, "/notes", methods, 2);
+    AddResource(blueprint, "/notes/archive", "GET");
+
+    RouteIndex index(blueprint);
+    RouteMatch match;
+
+    REQUIRE(index.size() == 3);
+    REQUIRE(index.skipped() == 0);
+
+    REQUIRE(index.match("GET", "/notes", match));
+    REQUIRE(match.resource == &blueprint.resourceGroups[0].resources[0]);
+    REQUIRE(match.action == &blueprint.resourceGroups[0].resources[0].actions[0]);
+    REQUIRE(match.resourceGroup == &blueprint.resourceGroups[0]);
+    REQUIRE(match.variables.empty());
+
+    REQUIRE(index.match("POST", "/notes", match));
+    REQUIRE(match.action == &blueprint.resourceGroups[0].resources[0].actions[1]);
+
+    REQUIRE(index.match("GET", "/notes/archive", match));
+    REQUIRE(match.resource == &blueprint.resourceGroups[0].resources[1]);
+
+    REQUIRE(!index.match("DELETE", "/notes", match));
+    REQUIRE(match.action == NULL);
+    REQUIRE(!index.match("GET", "/notes/", match));
+    REQUIRE(!index.match("GET", "/tags", match));
+}
+
+TEST_CASE("Route variables and literal precedence", "[routing]")
+{
+    Blueprint blueprint;
+    AddResource(blueprint, "/notes/{id}", "GET");
+    AddResource(blueprint, "/notes/new", "GET");
+    AddResource(blueprint, "/notes/{id}/tags/{tag}", "GET");
+
+    RouteIndex index(blueprint);
+    RouteMatch match;
+
+    REQUIRE(index.match("GET", "/notes/new", match));
+    REQUIRE(match.resource == &blueprint.resourceGroups[0].resources[1]);
+    REQUIRE(match.variables.empty());
+
+    REQUIRE(index.match("GET", "/notes/42", match));
+    REQUIRE(match.resource == &blueprint.resourceGroups[0].resources[0]);
+    REQUIRE(match.variables.size() == 1);
+    REQUIRE(match.variables[0].first == "id");
+    REQUIRE(match.variables[0].second == "42");
+
+    REQUIRE(index.match("GET", "/notes/42/tags/red", match));
+    REQUIRE(match.resource == &blueprint.resourceGroups[0].resources[2]);
+    REQUIRE(match.variables.size() == 2);
+    REQUIRE(match.variables[0].second == "42");
+    REQUIRE(match.variables[1].first == "tag");
+    REQUIRE(match.variables[1].second == "red");
+
+    REQUIRE(!index.match("GET", "/notes//tags/red", match));
+}
+
+TEST_CASE("Route segments mixing literals and expressions", "[routing]")
+{
+    Blueprint blueprint;
+    AddResource(blueprint, "/files/{name}.{format}", "GET");
+    AddResource(blueprint, "/files/{path}", "GET");
+
+    RouteIndex index(blueprint);
+    RouteMatch match;
+
+    REQUIRE(index.match("GET", "/files/report.json", match));
+    REQUIRE(match.resource == &blueprint.resourceGroups[0].resources[0]);
+    REQUIRE(match.variables.size() == 2);
+    REQUIRE(match.variables[0].second == "report");
+    REQUIRE(match.variables[1].second == "json");
+
+    REQUIRE(index.match("GET", "/files/report", match));
+    REQUIRE(match.resource == &blueprint.resourceGroups[0].resources[1]);
+}
+
+TEST_CASE("Route reserved expansion matching rest of the path", "[routing]")
+{
+    Blueprint blueprint;
+    AddResource(blueprint, "/assets/{+path}", "GET");
+
+    RouteIndex index(blueprint);
+    RouteMatch match;
+
+    REQUIRE(index.match("GET", "/assets/css/main.css", match));
+    REQUIRE(match.variables.size() == 1);
+    REQUIRE(match.variables[0].first == "path");
+    REQUIRE(match.variables[0].second == "css/main.css");
+
+    REQUIRE(!index.match("GET", "/assets/", match));
+}
+
+TEST_CASE("Route query and fragment expressions", "[routing]")
+{
+    Blueprint blueprint;
+    AddResource(blueprint, "http://api.example.com/notes{?limit,offset}{#section}", "GET");
+
+    RouteIndex index(blueprint);
+    RouteMatch match;
+
+    REQUIRE(index.match("GET", "/notes", match));
+    REQUIRE(match.variables.empty());
+
+    REQUIRE(index.match("GET", "/notes?offset=10&sort=asc&limit=5", match));
+    REQUIRE(match.variables.size() == 2);
+    REQUIRE(match.variables[0].first == "limit");
+    REQUIRE(match.variables[0].second == "5");
+    REQUIRE(match.variables[1].first == "offset");
+    REQUIRE(match.variables[1].second == "10");
+}
+
+TEST_CASE("Route unsupported and duplicate templates", "[routing]")
+{
+    Blueprint blueprint;
+    AddResource(blueprint, "/notes{/id}", "GET");
+    AddResource(blueprint, "/notes/{id", "GET");
+    AddResource(blueprint, "/notes/{id}", "GET");
+    AddResource(blueprint, "/notes/{noteId}", "GET");
+
+    RouteIndex index(blueprint);
+    RouteMatch match;
+
+    REQUIRE(index.size() == 1);
+    REQUIRE(index.skipped() == 3);
+
+    REQUIRE(index.match("GET", "/notes/1", match));
+    REQUIRE(match.resource == &blueprint.resourceGroups[0].resources[2]);
+}
+
+TEST_CASE("Route through C interface", "[routing]")
+{
+    Blueprint blueprint;
+    AddResource(blueprint, "/notes/{id}", "GET");
+
+    sc_route_index_t* index = sc_route_index_new(AS_CTYPE(sc_blueprint_t, &blueprint));
+    sc_route_match_t* match = sc_route_match_new();
+
+    REQUIRE(sc_route_index_size(index) == 1);
+    REQUIRE(sc_route_index_match(index, "GET", "/notes/1", match) == 1);
+    REQUIRE(sc_route_match_action(match) == AS_CTYPE(sc_action_t, &blueprint.resourceGroups[0].resources[0].actions[0]));
+    REQUIRE(sc_route_match_variables_size(match) == 1);
+    REQUIRE(std::string(sc_route_match_variable_name(match, 0)) == "id");
+    REQUIRE(std::string(sc_route_match_variable_value(match, 0)) == "1");
+
+    REQUIRE(sc_route_index_match(index, "PUT", "/notes/1", match) == 0);
+    REQUIRE(sc_route_match_action(match) == NULL);
+
+    sc_route_match_free(match);
+    sc_route_index_free(index);
+}
@@ -79,3 +79,22 @@ TEST_CASE("List adapter with Header section", "[adapter]")
 
     REQUIRE_THROWS_AS(ListSectionAdapter::startingNode(markdownAST.children().begin()), std::logic_error);
 }
+
+TEST_CASE("Match section keywords", "[signature]")
+{
+    REQUIRE(MatchSectionKeyword(StringView(std::string("Headers")), "Header", true));
+    REQUIRE(MatchSectionKeyword(StringView(std::string(" \theader ")), "Header", true));
+    REQUIRE(MatchSectionKeyword(StringView(std::string("data   Structures")), "Data Structures"));
+    REQUIRE(MatchSectionKeyword(StringView(std::string("Body")), "Body"));
+
+    REQUIRE_FALSE(MatchSectionKeyword(StringView(std::string("Bodys")), "Body"));
+    REQUIRE_FALSE(MatchSectionKeyword(StringView(std::string("HEADERS")), "Header", true));
+    REQUIRE_FALSE(MatchSectionKeyword(StringView(std::string("DataStructures")), "Data Structures"));
+    REQUIRE_FALSE(MatchSectionKeyword(StringView(std::string("Headers\n")), "Header", true));
+    REQUIRE_FALSE(MatchSectionKeyword(StringView(std::string("Headers x")), "Header", true));
+    REQUIRE_FALSE(MatchSectionKeyword(StringView(), "Body"));
+
+    REQUIRE(RecognizeCodeBlockFirstLine("  schema") == SchemaSectionType);
+    REQUIRE(RecognizeCodeBlockFirstLine("headers") == HeadersSectionType);
+    REQUIRE(RecognizeCodeBlockFirstLine("Body text") == UndefinedSectionType);
+}
@@ -0,0 +1,109 @@
+//
+//  test-Serialize.cc
+//  snowcrash
+//
+//  Created by agent on 10/19/26.
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <sstream>
+#include "snowcrashtest.h"
+#include "Serialize.h"
+#include "SerializeJSON.h"
+#include "SerializeYAML.h"
+
+using namespace snowcrash;
+using namespace snowcrashtest;
+
+TEST_CASE("Encode source map as base64 VLQ", "[serialize][sourcemap]")
+{
+    mdp::BytesRangeSet sourceMap;
+    sourceMap.push_back(mdp::BytesRange(0, 1));
+    sourceMap.push_back(mdp::BytesRange(16, 15));
+    sourceMap.push_back(mdp::BytesRange(10, 2));
+
+    // 0, 1; +15, 15; -21, 2
+    REQUIRE(EncodeSourceMapVLQ(sourceMap) == "ACeerBE");
+    REQUIRE(EncodeSourceMapVLQ(mdp::BytesRangeSet()).empty());
+}
+
+TEST_CASE("Merge adjacent ranges when encoding source map", "[serialize][sourcemap]")
+{
+    mdp::BytesRangeSet sourceMap;
+    sourceMap.push_back(mdp::BytesRange(4, 4));
+    sourceMap.push_back(mdp::BytesRange(8, 4));
+    sourceMap.push_back(mdp::BytesRange(20, 1));
+
+    mdp::BytesRangeSet decoded;
+    REQUIRE(DecodeSourceMapVLQ(EncodeSourceMapVLQ(sourceMap), decoded));
+
+    REQUIRE(decoded.size() == 2);
+    REQUIRE(decoded[0].location == 4);
+    REQUIRE(decoded[0].length == 8);
+    REQUIRE(decoded[1].location == 20);
+    REQUIRE(decoded[1].length == 1);
+}
+
+TEST_CASE("Decode source map round trip", "[serialize][sourcemap]")
+{
+    mdp::BytesRangeSet sourceMap;
+    sourceMap.push_back(mdp::BytesRange(123456, 789));
+    sourceMap.push_back(mdp::BytesRange(7, 1));
+    sourceMap.push_back(mdp::BytesRange(1000000, 0));
+
+    mdp::BytesRangeSet decoded;
+    REQUIRE(DecodeSourceMapVLQ(EncodeSourceMapVLQ(sourceMap), decoded));
+
+    REQUIRE(decoded.size() == sourceMap.size());
+
+    for (size_t i = 0; i < decoded.size(); ++i) {
+        REQUIRE(decoded[i].location == sourceMap[i].location);
+        REQUIRE(decoded[i].length == sourceMap[i].length);
+    }
+}
+
+TEST_CASE("Reject invalid encoded source map", "[serialize][sourcemap]")
+{
+    mdp::BytesRangeSet decoded;
+
+    // Invalid digit
+    REQUIRE_FALSE(DecodeSourceMapVLQ("A*", decoded));
+
+    // Truncated value
+    REQUIRE_FALSE(DecodeSourceMapVLQ("Ag", decoded));
+
+    // Missing length
+    REQUIRE_FALSE(DecodeSourceMapVLQ("C", decoded));
+
+    // Negative length
+    REQUIRE_FALSE(DecodeSourceMapVLQ("AB", decoded));
+
+    // Location before the start of the source
+    REQUIRE_FALSE(DecodeSourceMapVLQ("DA", decoded));
+}
+
+TEST_CASE("Serialize source map with VLQ encoding", "[serialize][sourcemap]")
+{
+    SourceMap<Blueprint> sourceMap;
+    sourceMap.name.sourceMap.push_back(mdp::BytesRange(0, 1));
+    sourceMap.name.sourceMap.push_back(mdp::BytesRange(1, 5));
+
+    std::stringstream json;
+    SetSourceMapEncoding(json, VLQSourceMapEncoding);
+    SerializeSourceMapJSON(sourceMap, json);
+
+    REQUIRE(json.str().find("\"name\": \"AM\"") != std::string::npos);
+    REQUIRE(json.str().find("\"description\": \"\"") != std::string::npos);
+
+    std::stringstream yaml;
+    SetSourceMapEncoding(yaml, VLQSourceMapEncoding);
+    SerializeSourceMapYAML(sourceMap, yaml);
+
+    REQUIRE(yaml.str().find("name: \"AM\"\n") != std::string::npos);
+
+    std::stringstream ranges;
+    SerializeSourceMapJSON(sourceMap, ranges);
+
+    REQUIRE(GetSourceMapEncoding(ranges) == RangesSourceMapEncoding);
+    REQUIRE(ranges.str().find("[0, 1]") != std::string::npos);
+}
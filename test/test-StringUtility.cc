@@ -63,3 +63,68 @@ TEST_CASE("comapare string", "[utility]"){
 
 }
 
+
+TEST_CASE("trim string view", "[utility]"){
+
+    std::string s = " \t abc def \n";
+
+    REQUIRE(TrimView(StringView(s)) == "abc def");
+    REQUIRE(TrimViewStart(StringView(s)) == "abc def \n");
+    REQUIRE(TrimViewEnd(StringView(s)) == " \t abc def");
+    REQUIRE(TrimView(StringView(std::string(" \n "))).empty());
+}
+
+TEST_CASE("view first line", "[utility]"){
+
+    std::string s = "first\nsecond\nthird";
+    StringView remaining;
+
+    REQUIRE(FirstLineView(StringView(s), remaining) == "first");
+    REQUIRE(remaining == "second\nthird");
+
+    std::string single = "single";
+
+    REQUIRE(FirstLineView(StringView(single), remaining) == "single");
+    REQUIRE(remaining.empty());
+}
+
+TEST_CASE("iterate lines as split does", "[utility]"){
+
+    const char* subjects[] = { "", "\n", "a", "a\n", "a\n\nb", "\n\na\n", "a\r\nb\r\n" };
+
+    for (size_t i = 0; i < sizeof(subjects) / sizeof(subjects[0]); ++i) {
+
+        std::string s = subjects[i];
+        std::vector<std::string> split = Split(s, '\n');
+
+        LineIterator lines((StringView(s)));
+        StringView line;
+        size_t count = 0;
+
+        while (lines.next(line)) {
+            REQUIRE(count < split.size());
+            REQUIRE(line == split[count]);
+            ++count;
+        }
+
+        REQUIRE(count == split.size());
+    }
+}
+
+TEST_CASE("split key value view", "[utility]"){
+
+    std::string s = " Content-Type :  application/json; a=b:c ";
+    StringView key, value;
+
+    REQUIRE(SplitKeyValue(StringView(s), ':', key, value));
+    REQUIRE(key == "Content-Type");
+    REQUIRE(value == "application/json; a=b:c");
+
+    std::string noDelimiter = "no delimiter";
+    REQUIRE_FALSE(SplitKeyValue(StringView(noDelimiter), ':', key, value));
+
+    std::string emptyValue = "key:";
+    REQUIRE(SplitKeyValue(StringView(emptyValue), ':', key, value));
+    REQUIRE(key == "key");
+    REQUIRE(value.empty());
+}
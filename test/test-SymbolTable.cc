@@ -29,3 +29,17 @@ TEST_CASE("Parse object resource symbol", "[symbol_table]")
 
     REQUIRE(resource.report.error.code != Error::OK);
 }
+
+TEST_CASE("Find symbol reference in text", "[symbol_table]")
+{
+    mdp::ByteBuffer text = "\n  [ Super Model ][]  \n";
+    mdp::BytesRange symbol;
+
+    REQUIRE(FindSymbolReference(text, symbol));
+    REQUIRE(text.substr(symbol.location, symbol.length) == "Super Model");
+
+    REQUIRE(!FindSymbolReference("{ \"id\": 42 }", symbol));
+    REQUIRE(!FindSymbolReference("[Super]", symbol));
+    REQUIRE(!FindSymbolReference("[][]", symbol));
+    REQUIRE(!FindSymbolReference("[Super (Model)][]", symbol));
+}
@@ -331,3 +331,53 @@ TEST_CASE("Parse uri template for consistent invalid character warning", "[inval
     REQUIRE(result2.report.warnings[0].message == "URI template expression \"$a,b,c\" contains invalid characters. Allowed characters for expressions are A-Z a-z 0-9 _ and percent encoded characters");
 
 }
+
+TEST_CASE("Parse a secure uri into seperate parts", "[validuriparser]")
+{
+    const snowcrash::URI uri = "https://www.test.com/other/{id}";
+
+    URITemplateParser parser;
+    ParsedURITemplate result;
+    mdp::CharactersRangeSet sourceBlock;
+
+    parser.parse(uri, sourceBlock, result);
+    REQUIRE(result.scheme == "https");
+    REQUIRE(result.host == "www.test.com");
+    REQUIRE(result.path == "/other/{id}");
+    REQUIRE(result.report.warnings.size() == 0);
+}
+
+TEST_CASE("Classify uri template expressions by operator", "[classifyexpression]")
+{
+    REQUIRE(URITemplateParser::classifyExpression("id").type == VariableExpressionType);
+    REQUIRE(URITemplateParser::classifyExpression("").type == VariableExpressionType);
+    REQUIRE(URITemplateParser::classifyExpression("?id").type == QueryStringExpressionType);
+    REQUIRE(URITemplateParser::classifyExpression("#id").type == FragmentExpressionType);
+    REQUIRE(URITemplateParser::classifyExpression("+id").type == ReservedExpansionExpressionType);
+    REQUIRE(URITemplateParser::classifyExpression(".id").type == LabelExpansionExpressionType);
+    REQUIRE(URITemplateParser::classifyExpression("/id").type == PathSegmentExpansionExpressionType);
+    REQUIRE(URITemplateParser::classifyExpression(";id").type == PathStyleParameterExpansionExpressionType);
+    REQUIRE(URITemplateParser::classifyExpression("&id").type == FormStyleQueryContinuationExpressionType);
+    REQUIRE(URITemplateParser::classifyExpression("|id").type == UndefinedExpressionType);
+
+    REQUIRE(URITemplateParser::classifyExpression("&id").IsSupportedExpressionType());
+    REQUIRE(!URITemplateParser::classifyExpression(".id").IsSupportedExpressionType());
+}
+
+TEST_CASE("Parse uri template with percent encoded and exploded expressions", "[validexpressions]")
+{
+    const snowcrash::URITemplate uri = "http://www.test.com/{a%20b}/{list*}{?q.name}";
+
+    URITemplateParser parser;
+    ParsedURITemplate result;
+    mdp::CharactersRangeSet sourceBlock;
+
+    parser.parse(uri, sourceBlock, result);
+
+    REQUIRE(result.report.warnings.empty());
+
+    ParsedURITemplate invalid;
+    parser.parse("http://www.test.com/{a%2}/{b..c}", sourceBlock, invalid);
+
+    REQUIRE(invalid.report.warnings.size() == 2);
+}
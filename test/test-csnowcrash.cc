@@ -8,6 +8,7 @@
 
 #include "snowcrashtest.h"
 #include "csnowcrash.h"
+#include "CBlueprintFlat.h"
 
 TEST_CASE("Parse simple blueprint with C interface", "[cinterface]")
 {
@@ -97,6 +98,7 @@ TEST_CASE("Parse simple blueprint with C interface", "[cinterface]")
     const sc_sm_action_t* sm_act = sc_sm_action_handle(sm_act_col, 0);
 
     REQUIRE(std::string(sc_action_httpmethod(act)) == "GET");
+    REQUIRE(sc_action_httpmethod_type(act) == SC_GET_HTTP_METHOD_TYPE);
 
     const sc_source_map_t* sm_act_httpmethod = sc_sm_action_httpmethod(sm_act);
 
@@ -129,6 +131,7 @@ TEST_CASE("Parse simple blueprint with C interface", "[cinterface]")
     const sc_sm_payload_t* sm_resp = sc_sm_payload_handle(sm_resp_col, 0);
 
     REQUIRE(std::string(sc_payload_name(resp)) == "200");
+    REQUIRE(sc_payload_status_code(resp) == 200);
     REQUIRE(std::string(sc_payload_body(resp)) == "Hello World!\n");
 
     const sc_source_map_t* sm_resp_name = sc_sm_payload_name(sm_resp);
@@ -402,3 +405,247 @@ TEST_CASE("Parse blueprint with multiple reference via C interface", "[cinterfac
     sc_blueprint_free(blueprint);
     sc_report_free(report);
 }
+
+TEST_CASE("Parse blueprints with reusable C parser", "[cinterface]")
+{
+    const std::string blueprintSource = \
+    "# API\n"\
+    "# GET /1\n"\
+    "+ Response 200\n";
+
+    sc_parser_t* parser = sc_parser_new();
+
+    for (int i = 0; i < 2; ++i) {
+
+        const sc_report_t* report;
+        const sc_blueprint_t* blueprint;
+        const sc_sm_blueprint_t* sm_blueprint;
+
+        int result = sc_parser_parse(parser, blueprintSource.c_str(), 0, NULL, &report, &blueprint, &sm_blueprint);
+
+        REQUIRE(result == 0);
+        REQUIRE(sc_warnings_size(sc_warnings_handler(report)) == 0);
+        REQUIRE(std::string(sc_blueprint_name(blueprint)) == "API");
+
+        const sc_resource_group_collection_t* res_gr_col = sc_resource_group_collection_handle(blueprint);
+        REQUIRE(sc_resource_group_collection_size(res_gr_col) == 1);
+        REQUIRE(sm_blueprint != NULL);
+    }
+
+    sc_parser_free(parser);
+}
+
+TEST_CASE("Reject NULL C parser", "[cinterface]")
+{
+    const sc_report_t* report;
+    const sc_blueprint_t* blueprint;
+    const sc_sm_blueprint_t* sm_blueprint;
+
+    int result = sc_parser_parse(NULL, "# API\n", 0, NULL, &report, &blueprint, &sm_blueprint);
+
+    REQUIRE(result != 0);
+    REQUIRE(report == NULL);
+    REQUIRE(blueprint == NULL);
+    REQUIRE(sm_blueprint == NULL);
+}
+
+TEST_CASE("Fetch skipped payload body on demand with C interface", "[cinterface]")
+{
+    const std::string blueprintSource = \
+    "# API\n"\
+    "# GET /1\n"\
+    "+ Response 200\n"\
+    "\n"\
+    "        {\n"\
+    "          \"a\": 1\n"\
+    "        }\n";
+
+    sc_report_t* report;
+    sc_blueprint_t* blueprint;
+    sc_sm_blueprint_t* sm_blueprint;
+
+    sc_c_parse(blueprintSource.c_str(), SC_EXPORT_SORUCEMAP_OPTION | SC_SKIP_BODIES_OPTION, &report, &blueprint, &sm_blueprint);
+
+    const sc_resource_group_collection_t* res_gr_col = sc_resource_group_collection_handle(blueprint);
+    const sc_resource_t* res = sc_resource_handle(sc_resource_collection_handle(sc_resource_group_handle(res_gr_col, 0)), 0);
+    const sc_action_t* act = sc_action_handle(sc_action_collection_handle(res), 0);
+    const sc_transaction_example_t* trans = sc_transaction_example_handle(sc_transaction_example_collection_handle(act), 0);
+    const sc_payload_t* resp = sc_payload_handle(sc_payload_collection_handle_responses(trans), 0);
+
+    REQUIRE(std::string(sc_payload_body(resp)) == "");
+
+    const sc_sm_resource_group_collection_t* sm_res_gr_col = sc_sm_resource_group_collection_handle(sm_blueprint);
+    const sc_sm_resource_t* sm_res = sc_sm_resource_handle(sc_sm_resource_collection_handle(sc_sm_resource_group_handle(sm_res_gr_col, 0)), 0);
+    const sc_sm_action_t* sm_act = sc_sm_action_handle(sc_sm_action_collection_handle(sm_res), 0);
+    const sc_sm_transaction_example_t* sm_trans = sc_sm_transaction_example_handle(sc_sm_transaction_example_collection_handle(sm_act), 0);
+    const sc_sm_payload_t* sm_resp = sc_sm_payload_handle(sc_sm_payload_collection_handle_responses(sm_trans), 0);
+    const sc_source_map_t* sm_resp_body = sc_sm_payload_body(sm_resp);
+
+    REQUIRE(sc_source_map_size(sm_resp_body) > 0);
+
+    size_t length;
+    const char* item = sc_source_map_asset_item(sm_resp_body, blueprintSource.c_str(), 0, &length);
+    REQUIRE(std::string(item, length).compare(0, 2, "{\n") == 0);
+
+    size_t bodyLength = sc_source_map_asset(sm_resp_body, blueprintSource.c_str(), NULL, 0);
+    REQUIRE(bodyLength == 13);
+
+    std::vector<char> body(bodyLength + 1);
+    sc_source_map_asset(sm_resp_body, blueprintSource.c_str(), &body[0], body.size());
+    REQUIRE(std::string(&body[0]) == "{\n  \"a\": 1\n}\n");
+
+    char truncated[3];
+    REQUIRE(sc_source_map_asset(sm_resp_body, blueprintSource.c_str(), truncated, sizeof(truncated)) == bodyLength);
+    REQUIRE(std::string(truncated) == "{\n");
+
+    sc_sm_blueprint_free(sm_blueprint);
+    sc_blueprint_free(blueprint);
+    sc_report_free(report);
+}
+
+TEST_CASE("Export flat blueprint with C interface", "[cinterface]")
+{
+    const std::string blueprintSource = \
+    "FORMAT: 1A\n"\
+    "\n"\
+    "# API\n"\
+    "# Group G\n"\
+    "## R [/r/{id}]\n"\
+    "+ Parameters\n"\
+    "    + id (string) ... Identifier\n"\
+    "\n"\
+    "### GET\n"\
+    "+ Response 200 (text/plain)\n"\
+    "\n"\
+    "        Hello\n";
+
+    sc_report_t* report;
+    sc_blueprint_t* blueprint;
+    sc_sm_blueprint_t* sm_blueprint;
+
+    sc_c_parse(blueprintSource.c_str(), SC_EXPORT_SORUCEMAP_OPTION, &report, &blueprint, &sm_blueprint);
+
+    sc_flat_blueprint_t* flat = sc_flat_blueprint_new(blueprint);
+    sc_flat_sm_blueprint_t* sm_flat = sc_flat_sm_blueprint_new(sm_blueprint);
+
+    sc_blueprint_free(blueprint);
+
+    const sc_flat_node_t* nodes;
+    const sc_flat_string_t* strings;
+    size_t blobLength;
+
+    size_t nodesSize = sc_flat_blueprint_nodes(flat, &nodes);
+    size_t stringsSize = sc_flat_blueprint_strings(flat, &strings);
+    const char* blob = sc_flat_blueprint_blob(flat, &blobLength);
+
+    // blueprint, metadata, group, resource, model, parameter, action, example, response, header, data structures
+    REQUIRE(nodesSize == 11);
+
+    REQUIRE(nodes[0].kind == SC_FLAT_BLUEPRINT);
+    REQUIRE(nodes[0].parent == SC_FLAT_NO_PARENT);
+    REQUIRE(std::string(blob + strings[nodes[0].fields].offset, strings[nodes[0].fields].length) == "API");
+
+    REQUIRE(nodes[1].kind == SC_FLAT_METADATA);
+    REQUIRE(nodes[1].parent == 0);
+    REQUIRE(nodes[1].fields_size == 2);
+    REQUIRE(std::string(blob + strings[nodes[1].fields + 1].offset, strings[nodes[1].fields + 1].length) == "1A");
+
+    REQUIRE(nodes[2].kind == SC_FLAT_RESOURCE_GROUP);
+    REQUIRE(nodes[3].kind == SC_FLAT_RESOURCE);
+    REQUIRE(nodes[3].parent == 2);
+    REQUIRE(std::string(blob + strings[nodes[3].fields].offset, strings[nodes[3].fields].length) == "/r/{id}");
+
+    REQUIRE(nodes[4].kind == SC_FLAT_MODEL);
+    REQUIRE(nodes[5].kind == SC_FLAT_PARAMETER);
+    REQUIRE(nodes[5].parent == 3);
+
+    REQUIRE(nodes[6].kind == SC_FLAT_ACTION);
+    REQUIRE(std::string(blob + strings[nodes[6].fields].offset, strings[nodes[6].fields].length) == "GET");
+    REQUIRE(nodes[7].kind == SC_FLAT_TRANSACTION_EXAMPLE);
+    REQUIRE(nodes[8].kind == SC_FLAT_RESPONSE);
+    REQUIRE(nodes[8].parent == 7);
+    REQUIRE(nodes[8].fields_size == 5);
+    REQUIRE(std::string(blob + strings[nodes[8].fields + 2].offset, strings[nodes[8].fields + 2].length) == "Hello\n");
+    REQUIRE(nodes[9].kind == SC_FLAT_HEADER);
+    REQUIRE(nodes[10].kind == SC_FLAT_DATA_STRUCTURES);
+    REQUIRE(nodes[10].parent == 0);
+
+    REQUIRE(stringsSize == nodes[10].fields + nodes[10].fields_size);
+
+    const sc_flat_node_t* sm_nodes;
+    const sc_flat_source_map_t* source_maps;
+    const sc_flat_range_t* ranges;
+
+    REQUIRE(sc_flat_sm_blueprint_nodes(sm_flat, &sm_nodes) == nodesSize);
+    // single source map of the metadata and header pairs, additional parameter use source map
+    REQUIRE(sc_flat_sm_blueprint_source_maps(sm_flat, &source_maps) == stringsSize - 1);
+    REQUIRE(sc_flat_sm_blueprint_ranges(sm_flat, &ranges) > 0);
+
+    REQUIRE(sm_nodes[1].kind == SC_FLAT_METADATA);
+    REQUIRE(sm_nodes[1].fields_size == 1);
+
+    const sc_flat_source_map_t& metadata = source_maps[sm_nodes[1].fields];
+    REQUIRE(metadata.ranges_size == 1);
+    REQUIRE(ranges[metadata.ranges].location == 0);
+    REQUIRE(ranges[metadata.ranges].length == 12);
+
+    // URI template and name of the resource share the header ranges
+    REQUIRE(sm_nodes[3].kind == SC_FLAT_RESOURCE);
+    REQUIRE(source_maps[sm_nodes[3].fields].ranges_size == 1);
+    REQUIRE(source_maps[sm_nodes[3].fields + 1].ranges == source_maps[sm_nodes[3].fields].ranges);
+    REQUIRE(source_maps[sm_nodes[3].fields + 1].ranges_size == 1);
+
+    sc_flat_sm_blueprint_free(sm_flat);
+    sc_flat_blueprint_free(flat);
+    sc_sm_blueprint_free(sm_blueprint);
+    sc_report_free(report);
+}
+
+TEST_CASE("Parse into a single result with C interface", "[cinterface]")
+{
+    const std::string blueprintSource = \
+    "# API\n"\
+    "# GET /1\n"\
+    "+ Response 200\n"\
+    "# Trailing garbage";
+
+    // Parse the source without its last line
+    size_t length = blueprintSource.find("# Trailing");
+
+    sc_parse_result_t* result;
+    const sc_report_t* report;
+    const sc_blueprint_t* blueprint;
+
+    int ret = sc_c_parse_v2(blueprintSource.c_str(), length, SC_EXPORT_SORUCEMAP_OPTION, &result, &report, &blueprint, NULL);
+
+    REQUIRE(ret == 0);
+    REQUIRE(report == sc_parse_result_report(result));
+    REQUIRE(blueprint == sc_parse_result_blueprint(result));
+    REQUIRE(sc_warnings_size(sc_warnings_handler(report)) == 0);
+    REQUIRE(std::string(sc_blueprint_name(blueprint)) == "API");
+
+    const sc_resource_group_collection_t* res_gr_col = sc_resource_group_collection_handle(blueprint);
+    REQUIRE(sc_resource_group_collection_size(res_gr_col) == 1);
+
+    // Source map not requested
+    const sc_sm_blueprint_t* sm_blueprint = sc_parse_result_sm_blueprint(result);
+    REQUIRE(sc_source_map_size(sc_sm_blueprint_name(sm_blueprint)) == 0);
+
+    sc_parse_result_free(result);
+
+    ret = sc_c_parse_v2(blueprintSource.c_str(), length, 0, &result, NULL, NULL, &sm_blueprint);
+
+    REQUIRE(ret == 0);
+    REQUIRE(sm_blueprint == sc_parse_result_sm_blueprint(result));
+    REQUIRE(sc_source_map_size(sc_sm_blueprint_name(sm_blueprint)) == 1);
+
+    sc_parse_result_free(result);
+
+    // Parse result is required
+    ret = sc_c_parse_v2(blueprintSource.c_str(), length, 0, NULL, &report, &blueprint, &sm_blueprint);
+
+    REQUIRE(ret != 0);
+    REQUIRE(report == NULL);
+    REQUIRE(blueprint == NULL);
+    REQUIRE(sm_blueprint == NULL);
+}
@@ -662,3 +662,162 @@ TEST_CASE("Don't mess up sourcemaps when there are references", "[parser][#213]"
     REQUIRE(blueprint.sourceMap.resourceGroups.collection[0].resources.collection[0].actions.collection[0].method.sourceMap[0].location == 111);
     REQUIRE(blueprint.sourceMap.resourceGroups.collection[0].resources.collection[0].actions.collection[0].method.sourceMap[0].length == 8);
 }
+
+TEST_CASE("Reuse parser for several blueprints", "[parser]")
+{
+    mdp::ByteBuffer first = \
+    "# API\n\n"\
+    "# Group A\n"\
+    "## /a\n"\
+    "### GET\n"\
+    "+ Response 200\n";
+
+    mdp::ByteBuffer second = \
+    "# Other API\n\n"\
+    "# GET /b\n"\
+    "+ Response 204\n";
+
+    Parser parser;
+
+    for (int i = 0; i < 2; ++i) {
+
+        ParseResult<Blueprint> reused, fresh;
+
+        parser.parse(first, ExportSourcemapOption, reused);
+        parse(first, ExportSourcemapOption, fresh);
+
+        REQUIRE(reused.report.error.code == Error::OK);
+        REQUIRE(reused.report.warnings.size() == fresh.report.warnings.size());
+        REQUIRE(reused.node.name == "API");
+        REQUIRE(reused.node.resourceGroups.size() == 1);
+        REQUIRE(reused.node.resourceGroups[0].resources.size() == 1);
+        REQUIRE(reused.node.resourceGroups[0].resources[0].uriTemplate == "/a");
+        REQUIRE(reused.sourceMap.name.sourceMap.size() == fresh.sourceMap.name.sourceMap.size());
+
+        ParseResult<Blueprint> other;
+        parser.parse(second, 0, other);
+
+        REQUIRE(other.report.error.code == Error::OK);
+        REQUIRE(other.node.name == "Other API");
+        REQUIRE(other.node.resourceGroups.size() == 1);
+        REQUIRE(other.node.resourceGroups[0].resources[0].uriTemplate == "/b");
+        REQUIRE(other.sourceMap.name.sourceMap.empty());
+    }
+}
+
+TEST_CASE("Reuse parser and its result for several blueprints", "[parser]")
+{
+    mdp::ByteBuffer model = \
+    "# API\n\n"\
+    "## Note [/note]\n"\
+    "+ Model (text/plain)\n\n"\
+    "        Hello\n\n"\
+    "### GET\n"\
+    "+ Response 200\n\n"\
+    "    [Note][]\n";
+
+    mdp::ByteBuffer reference = \
+    "# API\n\n"\
+    "## /other\n"\
+    "### GET\n"\
+    "+ Response 200\n\n"\
+    "    [Note][]\n";
+
+    Parser parser;
+    ParseResult<Blueprint> reused;
+
+    for (int i = 0; i < 2; ++i) {
+
+        ParseResult<Blueprint> fresh;
+
+        parser.parse(model, ExportSourcemapOption, reused);
+        parse(model, ExportSourcemapOption, fresh);
+
+        REQUIRE(reused.report.error.code == fresh.report.error.code);
+        REQUIRE(reused.report.warnings.size() == fresh.report.warnings.size());
+        REQUIRE(reused.node.resourceGroups.size() == 1);
+        REQUIRE(reused.node.resourceGroups[0].resources.size() == 1);
+        REQUIRE(reused.node.resourceGroups[0].resources[0].actions[0].examples[0].responses[0].body == "Hello\n");
+        REQUIRE(reused.sourceMap.resourceGroups.collection.size() == 1);
+
+        // The model of the previous parse is not kept
+        ParseResult<Blueprint> freshReference;
+
+        parser.parse(reference, 0, reused);
+        parse(reference, 0, freshReference);
+
+        REQUIRE(reused.report.error.code != Error::OK);
+        REQUIRE(reused.report.error.code == freshReference.report.error.code);
+        REQUIRE(reused.report.warnings.size() == freshReference.report.warnings.size());
+        REQUIRE(reused.sourceMap.resourceGroups.collection.empty());
+    }
+}
+
+TEST_CASE("Skip content while parsing", "[parser]")
+{
+    mdp::ByteBuffer source = \
+    "# API\n"\
+    "API description\n\n"\
+    "# Group A\n"\
+    "Group description\n\n"\
+    "## R [/r/{id}]\n"\
+    "Resource description\n\n"\
+    "+ Parameters\n"\
+    "    + id (string) ... Identifier\n\n"\
+    "### GET\n"\
+    "Action description\n\n"\
+    "+ Request\n\n"\
+    "        {}\n\n"\
+    "+ Response 204\n\n"\
+    "    + Body\n\n"\
+    "            Hello\n\n"\
+    "    + Schema\n\n"\
+    "            {}\n";
+
+    ParseResult<Blueprint> full, skipped;
+
+    parse(source, ExportSourcemapOption, full);
+    parse(source, ExportSourcemapOption | SkipBodiesOption | SkipSchemasOption | SkipDescriptionsOption | SkipParametersOption, skipped);
+
+    REQUIRE(full.report.error.code == Error::OK);
+    REQUIRE(skipped.report.error.code == Error::OK);
+    REQUIRE(skipped.report.warnings.size() == full.report.warnings.size());
+    REQUIRE(!full.report.warnings.empty());
+
+    REQUIRE(!full.node.description.empty());
+    REQUIRE(skipped.node.name == "API");
+    REQUIRE(skipped.node.description.empty());
+    REQUIRE(skipped.sourceMap.description.sourceMap.size() == 1);
+
+    REQUIRE(skipped.node.resourceGroups.size() == 1);
+    REQUIRE(skipped.node.resourceGroups[0].description.empty());
+
+    const Resource& resource = skipped.node.resourceGroups[0].resources[0];
+    const SourceMap<Resource>& resourceSourceMap = skipped.sourceMap.resourceGroups.collection[0].resources.collection[0];
+
+    REQUIRE(resource.description.empty());
+    REQUIRE(resource.parameters.empty());
+    REQUIRE(resourceSourceMap.parameters.collection.empty());
+
+    const Action& action = resource.actions[0];
+    const SourceMap<Action>& actionSourceMap = resourceSourceMap.actions.collection[0];
+
+    REQUIRE(action.method == "GET");
+    REQUIRE(action.description.empty());
+    REQUIRE(action.examples[0].requests[0].body.empty());
+    REQUIRE(action.examples[0].responses[0].name == "204");
+    REQUIRE(action.examples[0].responses[0].body.empty());
+    REQUIRE(action.examples[0].responses[0].schema.empty());
+    REQUIRE(!actionSourceMap.examples.collection[0].responses.collection[0].body.sourceMap.empty());
+    REQUIRE(!actionSourceMap.examples.collection[0].responses.collection[0].schema.sourceMap.empty());
+
+    // Checks of the skipped content do not depend on the source map export
+    ParseResult<Blueprint> detached;
+    parse(source, SkipBodiesOption | SkipSchemasOption | SkipDescriptionsOption | SkipParametersOption, detached);
+
+    REQUIRE(detached.report.error.code == Error::OK);
+    REQUIRE(detached.report.warnings.size() == full.report.warnings.size());
+    REQUIRE(detached.node.description.empty());
+    REQUIRE(detached.sourceMap.description.sourceMap.empty());
+    REQUIRE(detached.node.resourceGroups[0].resources[0].parameters.empty());
+}